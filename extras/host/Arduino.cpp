@@ -0,0 +1,526 @@
+/*
+  NAME:
+  Minimal Arduino core stand-in for host builds of library "gbj_apphelpers".
+
+  DESCRIPTION:
+  Implementation of simulated core functions and the String class.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include "Arduino.h"
+#include <chrono>
+
+HostHeapStats hostHeap = { 0, 0, 0 };
+
+namespace
+{
+  const uint8_t PINS = 64;
+  int pinValues[PINS];
+  bool clockManual = false;
+  unsigned long clockMs = 0;
+  unsigned long delayedMs = 0;
+  const std::chrono::steady_clock::time_point clockStart =
+    std::chrono::steady_clock::now();
+
+  unsigned long long elapsedUs()
+  {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - clockStart)
+      .count();
+  }
+}
+
+//------------------------------------------------------------------------------
+// Heap accounting
+//------------------------------------------------------------------------------
+void *hostMalloc(size_t size)
+{
+  hostHeap.allocs++;
+  hostHeap.bytes += size;
+  return malloc(size);
+}
+
+void *hostRealloc(void *ptr, size_t size)
+{
+  hostHeap.allocs++;
+  hostHeap.bytes += size;
+  return realloc(ptr, size);
+}
+
+void hostFree(void *ptr)
+{
+  if (ptr)
+  {
+    hostHeap.frees++;
+  }
+  free(ptr);
+}
+
+//------------------------------------------------------------------------------
+// Simulated core
+//------------------------------------------------------------------------------
+unsigned long millis()
+{
+  return clockManual ? clockMs : static_cast<unsigned long>(elapsedUs() / 1000);
+}
+
+unsigned long micros()
+{
+  return clockManual ? clockMs * 1000
+                     : static_cast<unsigned long>(elapsedUs());
+}
+
+void delay(unsigned long ms)
+{
+  delayedMs += ms;
+  if (clockManual)
+  {
+    clockMs += ms;
+  }
+}
+
+void yield() {}
+
+void pinMode(uint8_t, uint8_t) {}
+
+int digitalRead(uint8_t pin)
+{
+  return pin < PINS ? pinValues[pin] : LOW;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+  hostPinSet(pin, val);
+}
+
+void hostClockSet(unsigned long ms)
+{
+  clockManual = true;
+  clockMs = ms;
+}
+
+void hostClockAdvance(unsigned long ms)
+{
+  clockManual = true;
+  clockMs += ms;
+}
+
+void hostClockRelease()
+{
+  clockManual = false;
+}
+
+void hostPinSet(uint8_t pin, int val)
+{
+  if (pin < PINS)
+  {
+    pinValues[pin] = val ? HIGH : LOW;
+  }
+}
+
+unsigned long hostDelayed()
+{
+  return delayedMs;
+}
+
+//------------------------------------------------------------------------------
+// String
+//------------------------------------------------------------------------------
+String::String(const char *cstr)
+{
+  init();
+  if (cstr)
+  {
+    copy(cstr, strlen(cstr));
+  }
+}
+
+String::String(const String &str)
+{
+  init();
+  *this = str;
+}
+
+String::String(String &&str)
+{
+  init();
+  move(str);
+}
+
+String::String(const __FlashStringHelper *str)
+{
+  init();
+  *this = str;
+}
+
+String::String(char c)
+{
+  init();
+  char buf[2] = { c, 0 };
+  *this = buf;
+}
+
+String::String(unsigned char value, unsigned char base)
+  : String(static_cast<unsigned long>(value), base)
+{
+}
+
+String::String(int value, unsigned char base)
+  : String(static_cast<long>(value), base)
+{
+}
+
+String::String(unsigned int value, unsigned char base)
+  : String(static_cast<unsigned long>(value), base)
+{
+}
+
+String::String(long value, unsigned char base)
+{
+  init();
+  char buf[2 + 8 * sizeof(long)];
+  if (base == 10)
+  {
+    snprintf(buf, sizeof(buf), "%ld", value);
+  }
+  else
+  {
+    snprintf(buf, sizeof(buf), base == 16 ? "%lx" : "%lo", value);
+  }
+  *this = buf;
+}
+
+String::String(unsigned long value, unsigned char base)
+{
+  init();
+  char buf[1 + 8 * sizeof(unsigned long)];
+  snprintf(buf,
+           sizeof(buf),
+           base == 10 ? "%lu" : (base == 16 ? "%lx" : "%lo"),
+           value);
+  *this = buf;
+}
+
+String::String(float value, unsigned char decimalPlaces)
+  : String(static_cast<double>(value), decimalPlaces)
+{
+}
+
+String::String(double value, unsigned char decimalPlaces)
+{
+  init();
+  char buf[33];
+  snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, value);
+  *this = buf;
+}
+
+String::~String()
+{
+  hostFree(buffer_);
+}
+
+void String::init()
+{
+  buffer_ = NULL;
+  capacity_ = 0;
+  len_ = 0;
+}
+
+void String::invalidate()
+{
+  hostFree(buffer_);
+  init();
+}
+
+bool String::reserve(unsigned int size)
+{
+  if (buffer_ && capacity_ >= size)
+  {
+    return true;
+  }
+  if (changeBuffer(size))
+  {
+    if (len_ == 0)
+    {
+      buffer_[0] = 0;
+    }
+    return true;
+  }
+  return false;
+}
+
+bool String::changeBuffer(unsigned int maxStrLen)
+{
+  char *newbuffer = static_cast<char *>(hostRealloc(buffer_, maxStrLen + 1));
+  if (newbuffer)
+  {
+    buffer_ = newbuffer;
+    capacity_ = maxStrLen;
+    return true;
+  }
+  return false;
+}
+
+String &String::copy(const char *cstr, unsigned int length)
+{
+  if (!reserve(length))
+  {
+    invalidate();
+    return *this;
+  }
+  len_ = length;
+  memcpy(buffer_, cstr, length);
+  buffer_[len_] = 0;
+  return *this;
+}
+
+void String::move(String &rhs)
+{
+  if (this != &rhs)
+  {
+    hostFree(buffer_);
+    buffer_ = rhs.buffer_;
+    capacity_ = rhs.capacity_;
+    len_ = rhs.len_;
+    rhs.init();
+  }
+}
+
+String &String::operator=(const String &rhs)
+{
+  if (this == &rhs)
+  {
+    return *this;
+  }
+  if (rhs.buffer_)
+  {
+    copy(rhs.buffer_, rhs.len_);
+  }
+  else
+  {
+    invalidate();
+  }
+  return *this;
+}
+
+String &String::operator=(String &&rhs)
+{
+  move(rhs);
+  return *this;
+}
+
+String &String::operator=(const char *cstr)
+{
+  if (cstr)
+  {
+    copy(cstr, strlen(cstr));
+  }
+  else
+  {
+    invalidate();
+  }
+  return *this;
+}
+
+String &String::operator=(const __FlashStringHelper *str)
+{
+  return *this = reinterpret_cast<const char *>(str);
+}
+
+bool String::concat(const char *cstr, unsigned int length)
+{
+  unsigned int newlen = len_ + length;
+  if (!cstr)
+  {
+    return false;
+  }
+  if (length == 0)
+  {
+    return true;
+  }
+  if (!reserve(newlen))
+  {
+    return false;
+  }
+  memmove(buffer_ + len_, cstr, length);
+  len_ = newlen;
+  buffer_[len_] = 0;
+  return true;
+}
+
+bool String::concat(const String &str)
+{
+  return concat(str.c_str(), str.len_);
+}
+
+bool String::concat(const char *cstr)
+{
+  return cstr ? concat(cstr, strlen(cstr)) : false;
+}
+
+bool String::concat(char c)
+{
+  return concat(&c, 1);
+}
+
+bool String::concat(unsigned char num)
+{
+  return concat(String(num));
+}
+
+bool String::concat(int num)
+{
+  return concat(String(num));
+}
+
+bool String::concat(unsigned int num)
+{
+  return concat(String(num));
+}
+
+bool String::concat(long num)
+{
+  return concat(String(num));
+}
+
+bool String::concat(unsigned long num)
+{
+  return concat(String(num));
+}
+
+bool String::concat(const __FlashStringHelper *str)
+{
+  return concat(reinterpret_cast<const char *>(str));
+}
+
+char String::charAt(unsigned int index) const
+{
+  return (*this)[index];
+}
+
+char String::operator[](unsigned int index) const
+{
+  if (index >= len_ || !buffer_)
+  {
+    return 0;
+  }
+  return buffer_[index];
+}
+
+char &String::operator[](unsigned int index)
+{
+  static char dummy_writable_char;
+  if (index >= len_ || !buffer_)
+  {
+    dummy_writable_char = 0;
+    return dummy_writable_char;
+  }
+  return buffer_[index];
+}
+
+void String::replace(const String &find, const String &replace)
+{
+  if (len_ == 0 || find.len_ == 0)
+  {
+    return;
+  }
+  String result;
+  const char *readFrom = c_str();
+  const char *foundAt;
+  while ((foundAt = strstr(readFrom, find.c_str())) != NULL)
+  {
+    result.concat(readFrom, foundAt - readFrom);
+    result.concat(replace);
+    readFrom = foundAt + find.len_;
+  }
+  result.concat(readFrom);
+  copy(result.c_str(), result.len_);
+}
+
+bool String::equals(const String &str) const
+{
+  return len_ == str.len_ && strcmp(c_str(), str.c_str()) == 0;
+}
+
+bool String::equals(const char *cstr) const
+{
+  return strcmp(c_str(), cstr ? cstr : "") == 0;
+}
+
+String operator+(const String &lhs, const String &rhs)
+{
+  String result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+String operator+(const String &lhs, const char *rhs)
+{
+  String result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+String operator+(const char *lhs, const String &rhs)
+{
+  String result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+String operator+(const String &lhs, char rhs)
+{
+  String result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+//------------------------------------------------------------------------------
+// Print, Stream
+//------------------------------------------------------------------------------
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t n = 0;
+  while (size--)
+  {
+    if (write(*buffer++))
+    {
+      n++;
+    }
+    else
+    {
+      break;
+    }
+  }
+  return n;
+}
+
+size_t Print::print(unsigned long value)
+{
+  char buf[1 + 8 * sizeof(unsigned long)];
+  snprintf(buf, sizeof(buf), "%lu", value);
+  return write(buf);
+}
+
+size_t Print::print(long value)
+{
+  char buf[2 + 8 * sizeof(long)];
+  snprintf(buf, sizeof(buf), "%ld", value);
+  return write(buf);
+}
+
+size_t Stream::readBytes(char *buffer, size_t length)
+{
+  size_t count = 0;
+  while (count < length && available() > 0)
+  {
+    *buffer++ = static_cast<char>(read());
+    count++;
+  }
+  return count;
+}
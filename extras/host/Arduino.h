@@ -0,0 +1,201 @@
+/*
+  NAME:
+  Minimal Arduino core stand-in for host builds of library "gbj_apphelpers".
+
+  DESCRIPTION:
+  The header provides just that subset of the Arduino core API, which the
+  library and its unit tests use, so that they can be compiled and exercised
+  on a Linux host with benchmarks and Unity tests.
+  - The String class mimics the AVR core one including its heap usage, i.e.,
+    the buffer is reallocated to the exact needed length at every growth.
+  - All heap operations of the String class are counted in the host heap
+    statistics, which are used for allocation reports of benchmarks.
+  - Digital pins and milliseconds timer are simulated and can be driven
+    by a test.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#ifndef ARDUINO_HOST_H
+#define ARDUINO_HOST_H
+
+#include <ctype.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARDUINO 10819
+#define ARDUINO_HOST
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+typedef uint8_t byte;
+typedef uint16_t word;
+typedef bool boolean;
+
+// Flash memory access is just a plain memory access on the host
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*reinterpret_cast<const uint8_t *>(addr))
+#define pgm_read_word(addr) (*reinterpret_cast<const uint16_t *>(addr))
+#define pgm_read_dword(addr) (*reinterpret_cast<const uint32_t *>(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+class __FlashStringHelper;
+#define F(string_literal)                                                      \
+  (reinterpret_cast<const __FlashStringHelper *>(PSTR(string_literal)))
+
+// Simulated core functions
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+
+// Host simulation controls
+struct HostHeapStats
+{
+  unsigned long allocs;
+  unsigned long bytes;
+  unsigned long frees;
+};
+extern HostHeapStats hostHeap;
+void *hostMalloc(size_t size);
+void *hostRealloc(void *ptr, size_t size);
+void hostFree(void *ptr);
+void hostClockSet(unsigned long ms);
+void hostClockAdvance(unsigned long ms);
+void hostClockRelease();
+void hostPinSet(uint8_t pin, int val);
+unsigned long hostDelayed();
+
+class String
+{
+public:
+  String(const char *cstr = "");
+  String(const String &str);
+  String(String &&str);
+  String(const __FlashStringHelper *str);
+  explicit String(char c);
+  explicit String(unsigned char value, unsigned char base = 10);
+  explicit String(int value, unsigned char base = 10);
+  explicit String(unsigned int value, unsigned char base = 10);
+  explicit String(long value, unsigned char base = 10);
+  explicit String(unsigned long value, unsigned char base = 10);
+  explicit String(float value, unsigned char decimalPlaces = 2);
+  explicit String(double value, unsigned char decimalPlaces = 2);
+  ~String();
+
+  String &operator=(const String &rhs);
+  String &operator=(String &&rhs);
+  String &operator=(const char *cstr);
+  String &operator=(const __FlashStringHelper *str);
+
+  bool reserve(unsigned int size);
+  inline unsigned int length() const { return len_; }
+  inline const char *c_str() const { return buffer_ ? buffer_ : ""; }
+
+  bool concat(const String &str);
+  bool concat(const char *cstr);
+  bool concat(const char *cstr, unsigned int length);
+  bool concat(char c);
+  bool concat(unsigned char num);
+  bool concat(int num);
+  bool concat(unsigned int num);
+  bool concat(long num);
+  bool concat(unsigned long num);
+  bool concat(const __FlashStringHelper *str);
+
+  template<class T>
+  String &operator+=(T rhs)
+  {
+    concat(rhs);
+    return *this;
+  }
+
+  char charAt(unsigned int index) const;
+  char operator[](unsigned int index) const;
+  char &operator[](unsigned int index);
+  void replace(const String &find, const String &replace);
+  bool equals(const String &str) const;
+  bool equals(const char *cstr) const;
+  bool operator==(const String &rhs) const { return equals(rhs); }
+  bool operator==(const char *cstr) const { return equals(cstr); }
+  bool operator!=(const String &rhs) const { return !equals(rhs); }
+  bool operator!=(const char *cstr) const { return !equals(cstr); }
+
+private:
+  char *buffer_;
+  unsigned int capacity_;
+  unsigned int len_;
+
+  void init();
+  void invalidate();
+  bool changeBuffer(unsigned int maxStrLen);
+  String &copy(const char *cstr, unsigned int length);
+  void move(String &rhs);
+};
+
+String operator+(const String &lhs, const String &rhs);
+String operator+(const String &lhs, const char *rhs);
+String operator+(const char *lhs, const String &rhs);
+String operator+(const String &lhs, char rhs);
+
+class Print
+{
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  size_t write(const char *str)
+  {
+    return str ? write(reinterpret_cast<const uint8_t *>(str), strlen(str))
+               : 0;
+  }
+  size_t write(const char *buffer, size_t size)
+  {
+    return write(reinterpret_cast<const uint8_t *>(buffer), size);
+  }
+  size_t print(const char *str) { return write(str); }
+  size_t print(const String &str) { return write(str.c_str(), str.length()); }
+  size_t print(char c) { return write(static_cast<uint8_t>(c)); }
+  size_t print(unsigned long value);
+  size_t print(long value);
+  size_t print(int value) { return print(static_cast<long>(value)); }
+  size_t print(unsigned int value)
+  {
+    return print(static_cast<unsigned long>(value));
+  }
+  size_t println() { return write("\r\n"); }
+  template<class T>
+  size_t println(T value)
+  {
+    size_t n = print(value);
+    return n + println();
+  }
+};
+
+class Stream : public Print
+{
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  size_t readBytes(char *buffer, size_t length);
+};
+
+#endif
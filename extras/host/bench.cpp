@@ -0,0 +1,262 @@
+/*
+  NAME:
+  Benchmark harness of library "gbj_apphelpers" for host builds.
+
+  DESCRIPTION:
+  The runner executes all registered benchmark cases and reports time,
+  number of heap allocations, and allocated bytes per single operation.
+  - On x86 hosts it reports also CPU cycles per operation read by the time
+    stamp counter, otherwise the cycles are reported as null or "-".
+  - The report is in JSON by default in order to be stored and compared
+    between library releases.
+
+  USAGE:
+  gbj_apphelpers_bench [--format=json|text] [--filter=<substring>]
+                       [--min-time=<milliseconds>]
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include "bench.h"
+#include <chrono>
+#include <new>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+  #define BENCH_CYCLES 1
+#endif
+
+#ifndef GBJ_APPHELPERS_VERSION
+  #define GBJ_APPHELPERS_VERSION "unknown"
+#endif
+
+namespace
+{
+  struct BenchCase
+  {
+    std::string name;
+    BenchBody body;
+  };
+
+  struct BenchResult
+  {
+    std::string name;
+    unsigned long iterations;
+    double nsPerOp;
+    double cyclesPerOp;
+    double allocsPerOp;
+    double bytesPerOp;
+  };
+
+  const unsigned long ITERATIONS_MAX = 1000000000UL;
+
+  inline unsigned long long cycles()
+  {
+#ifdef BENCH_CYCLES
+    return __rdtsc();
+#else
+    return 0;
+#endif
+  }
+
+  std::vector<BenchCase> &registry()
+  {
+    static std::vector<BenchCase> cases;
+    return cases;
+  }
+
+  BenchResult measure(const BenchCase &bench, double minTimeNs)
+  {
+    BenchResult result;
+    unsigned long iterations = 1;
+    while (true)
+    {
+      hostHeap = HostHeapStats{ 0, 0, 0 };
+      std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+      unsigned long long startCycles = cycles();
+      bench.body(iterations);
+      benchClobber();
+      unsigned long long elapsedCycles = cycles() - startCycles;
+      double elapsed = std::chrono::duration<double, std::nano>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+      HostHeapStats heap = hostHeap;
+      if (elapsed >= minTimeNs || iterations >= ITERATIONS_MAX)
+      {
+        result.name = bench.name;
+        result.iterations = iterations;
+        result.nsPerOp = elapsed / iterations;
+        result.cyclesPerOp = static_cast<double>(elapsedCycles) / iterations;
+        result.allocsPerOp = static_cast<double>(heap.allocs) / iterations;
+        result.bytesPerOp = static_cast<double>(heap.bytes) / iterations;
+        return result;
+      }
+      // Estimate iterations for the minimal time with a safety margin
+      double factor = elapsed > 0 ? 1.4 * minTimeNs / elapsed : 100.0;
+      if (factor > 100.0)
+      {
+        factor = 100.0;
+      }
+      if (factor < 2.0)
+      {
+        factor = 2.0;
+      }
+      iterations = static_cast<unsigned long>(iterations * factor);
+    }
+  }
+
+  void reportJson(const std::vector<BenchResult> &results)
+  {
+    printf("{\n");
+    printf("  \"library\": \"gbj_apphelpers\",\n");
+    printf("  \"version\": \"%s\",\n", GBJ_APPHELPERS_VERSION);
+    printf("  \"compiler\": \"%s\",\n", __VERSION__);
+    printf("  \"benchmarks\": [");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+      const BenchResult &r = results[i];
+      char cycles[24] = "null";
+#ifdef BENCH_CYCLES
+      snprintf(cycles, sizeof(cycles), "%.3f", r.cyclesPerOp);
+#endif
+      printf("%s\n    {\"name\": \"%s\", \"iterations\": %lu, "
+             "\"ns_per_op\": %.3f, \"cycles_per_op\": %s, "
+             "\"allocs_per_op\": %.3f, \"bytes_per_op\": %.3f}",
+             i ? "," : "",
+             r.name.c_str(),
+             r.iterations,
+             r.nsPerOp,
+             cycles,
+             r.allocsPerOp,
+             r.bytesPerOp);
+    }
+    printf("\n  ]\n}\n");
+  }
+
+  void reportText(const std::vector<BenchResult> &results)
+  {
+    printf("%-44s %12s %12s %12s %12s\n",
+           "benchmark",
+           "ns/op",
+           "cycles/op",
+           "allocs/op",
+           "bytes/op");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+      const BenchResult &r = results[i];
+      char cycles[24] = "-";
+#ifdef BENCH_CYCLES
+      snprintf(cycles, sizeof(cycles), "%.2f", r.cyclesPerOp);
+#endif
+      printf("%-44s %12.2f %12s %12.2f %12.2f\n",
+             r.name.c_str(),
+             r.nsPerOp,
+             cycles,
+             r.allocsPerOp,
+             r.bytesPerOp);
+    }
+  }
+}
+
+void benchRegister(const std::string &name, BenchBody body)
+{
+  BenchCase bench;
+  bench.name = name;
+  bench.body = body;
+  registry().push_back(bench);
+}
+
+// Count heap allocations made by C++ operators as well
+void *operator new(size_t size)
+{
+  void *ptr = hostMalloc(size ? size : 1);
+  if (!ptr)
+  {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void *operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+  hostFree(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+  hostFree(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+  hostFree(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+  hostFree(ptr);
+}
+
+int main(int argc, char *argv[])
+{
+  bool json = true;
+  std::string filter;
+  double minTimeMs = 100.0;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string arg = argv[i];
+    if (arg == "--format=text")
+    {
+      json = false;
+    }
+    else if (arg == "--format=json")
+    {
+      json = true;
+    }
+    else if (arg.compare(0, 9, "--filter=") == 0)
+    {
+      filter = arg.substr(9);
+    }
+    else if (arg.compare(0, 11, "--min-time=") == 0)
+    {
+      minTimeMs = atof(arg.c_str() + 11);
+    }
+    else
+    {
+      fprintf(stderr,
+              "Usage: %s [--format=json|text] [--filter=<substring>] "
+              "[--min-time=<milliseconds>]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+  std::vector<BenchResult> results;
+  for (size_t i = 0; i < registry().size(); i++)
+  {
+    const BenchCase &bench = registry()[i];
+    if (!filter.empty() && bench.name.find(filter) == std::string::npos)
+    {
+      continue;
+    }
+    results.push_back(measure(bench, minTimeMs * 1e6));
+  }
+  if (json)
+  {
+    reportJson(results);
+  }
+  else
+  {
+    reportText(results);
+  }
+  return 0;
+}
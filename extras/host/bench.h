@@ -0,0 +1,56 @@
+/*
+  NAME:
+  Benchmark harness of library "gbj_apphelpers" for host builds.
+
+  DESCRIPTION:
+  The header declares a minimal benchmark registry. Each benchmark case is
+  a function executing the measured operation the provided number of times.
+  - The harness calibrates number of iterations so that each case runs
+    at least the minimal time.
+  - Heap operations are counted by the host Arduino stand-in and by the
+    replaced global new operators.
+  - Cases are registered from static initializers of individual benchmark
+    suites by the macro BENCH_SUITE.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#ifndef GBJ_APPHELPERS_BENCH_H
+#define GBJ_APPHELPERS_BENCH_H
+
+#include <Arduino.h>
+#include <functional>
+#include <string>
+
+using BenchBody = std::function<void(unsigned long iterations)>;
+
+void benchRegister(const std::string &name, BenchBody body);
+
+// Prevent the compiler from optimizing away a computed value
+template<class T>
+inline void benchKeep(const T &value)
+{
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Force the compiler to assume all memory has been read and written
+inline void benchClobber()
+{
+  asm volatile("" : : : "memory");
+}
+
+struct BenchRegistrar
+{
+  explicit BenchRegistrar(void (*suite)()) { suite(); }
+};
+
+#define BENCH_SUITE(suite)                                                     \
+  static void suite();                                                         \
+  static BenchRegistrar suite##_registrar(suite);                              \
+  static void suite()
+
+#endif
@@ -0,0 +1,510 @@
+/*
+  NAME:
+  Benchmarks of library "gbj_apphelpers" public methods.
+
+  DESCRIPTION:
+  The suite provides a benchmark case for every public method of the library.
+  - Input values vary with iterations in order to avoid constant folding.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include "bench.h"
+#include <gbj_apphelpers.h>
+
+namespace
+{
+  // Typical URL query payload published to cloud services
+  const char URL_PLAIN[] = "field1=23.45&field2=55.10&status=Sensor OK, "
+                           "boot #12 (wifi) ~ 100% [done]";
+  const char URL_ENCODED[] = "field1%3D23%2E45%26field2%3D55%2E10%26status%3D"
+                             "Sensor+OK%2C+boot+%2312+%28wifi%29+%7E+100%25+"
+                             "%5Bdone%5D";
+  // Print sink discarding written characters
+  class NullSink : public Print
+  {
+  public:
+    size_t write(uint8_t c) { return 1; }
+    size_t write(const uint8_t *buffer, size_t size)
+    {
+      benchKeep(buffer);
+      return size;
+    }
+  };
+  // Epoch time 2021-08-16 12:34:56
+  const unsigned long EPOCH = 1629117296UL;
+}
+
+BENCH_SUITE(calculations)
+{
+  benchRegister("calculateDewpoint", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::calculateDewpoint(30.0 + (i & 63),
+                                                  -10.0 + (i & 31)));
+    }
+  });
+  benchRegister("calculateDigits", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::calculateDigits(
+        static_cast<uint32_t>(i * 2654435761UL)));
+    }
+  });
+  benchRegister("calculateDigits/reference", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      // Original counting of the library up to version 1.12.0
+      uint32_t number = i * 2654435761UL;
+      uint8_t digits = 0;
+      do
+      {
+        number /= 10;
+        digits++;
+      } while (number);
+      benchKeep(digits);
+    }
+  });
+  benchRegister("calculateDigits/uint64", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::calculateDigits(
+        static_cast<uint64_t>(i) * 0x9E3779B97F4A7C15ULL));
+    }
+  });
+  benchRegister("calculateDigits/int16", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::calculateDigits(
+        static_cast<int16_t>(i * 2654435761UL)));
+    }
+  });
+}
+
+BENCH_SUITE(conversions)
+{
+  benchRegister("convertCelsius2Fahrenheit", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::convertCelsius2Fahrenheit(i & 127));
+    }
+  });
+  benchRegister("convertFahrenheit2Celsius", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::convertFahrenheit2Celsius(i & 127));
+    }
+  });
+  benchRegister("convertMs2Sec", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::convertMs2Sec(i * 7919));
+    }
+  });
+  benchRegister("convertReboot2Text", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      String text = gbj_apphelpers::convertReboot2Text(
+        static_cast<gbj_apphelpers::McuReboots>(i % 7));
+      benchKeep(text);
+    }
+  });
+  benchRegister("getRebootText", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::getRebootText(i % 7));
+    }
+  });
+  benchRegister("RebootStats/add", [](unsigned long iterations) {
+    gbj_apphelpers::RebootStats<16> stats;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      stats.add(i % 7, i, 1600000000UL + i);
+      benchClobber();
+    }
+  });
+  benchRegister("RebootStats/deserialize", [](unsigned long iterations) {
+    gbj_apphelpers::RebootStats<16> stats;
+    for (uint8_t i = 0; i < 21; i++)
+    {
+      stats.add(i % 7, i);
+    }
+    uint8_t buffer[gbj_apphelpers::RebootStats<16>::SIZE];
+    stats.serialize(buffer, sizeof(buffer));
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(stats.deserialize(buffer, sizeof(buffer)));
+    }
+  });
+  benchRegister("urlencode", [](unsigned long iterations) {
+    String str = URL_PLAIN;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      String text = gbj_apphelpers::urlencode(str);
+      benchKeep(text);
+    }
+  });
+  benchRegister("urldecode", [](unsigned long iterations) {
+    String str = URL_ENCODED;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      String text = gbj_apphelpers::urldecode(str);
+      benchKeep(text);
+    }
+  });
+  benchRegister("urlencode/sink", [](unsigned long iterations) {
+    NullSink sink;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(
+        gbj_apphelpers::urlencode(sink, URL_PLAIN, sizeof(URL_PLAIN) - 1));
+    }
+  });
+  benchRegister("urldecode/sink", [](unsigned long iterations) {
+    NullSink sink;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(
+        gbj_apphelpers::urldecode(sink, URL_ENCODED, sizeof(URL_ENCODED) - 1));
+    }
+  });
+  benchRegister("urldecode/in_place", [](unsigned long iterations) {
+    char buffer[sizeof(URL_ENCODED)];
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      memcpy(buffer, URL_ENCODED, sizeof(URL_ENCODED));
+      benchKeep(gbj_apphelpers::urldecode(buffer, sizeof(URL_ENCODED) - 1));
+      benchClobber();
+    }
+  });
+  benchRegister("urlencodeLength", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(
+        gbj_apphelpers::urlencodeLength(URL_PLAIN, sizeof(URL_PLAIN) - 1));
+      benchClobber();
+    }
+  });
+  benchRegister("convertEpoch2Datetime", [](unsigned long iterations) {
+    gbj_apphelpers::Datetime dtRecord;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      gbj_apphelpers::convertEpoch2Datetime(dtRecord, EPOCH + i * 86413UL);
+      benchKeep(dtRecord);
+    }
+  });
+  benchRegister("convertDatetime2Epoch", [](unsigned long iterations) {
+    gbj_apphelpers::Datetime dtRecord;
+    gbj_apphelpers::convertEpoch2Datetime(dtRecord, EPOCH);
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      dtRecord.second = i % 60;
+      benchKeep(gbj_apphelpers::convertDatetime2Epoch(dtRecord));
+    }
+  });
+  benchRegister("uptimeSecondsCummulate", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::uptimeSecondsCummulate(i * 997));
+    }
+  });
+  benchRegister("UptimeCounter/update", [](unsigned long iterations) {
+    gbj_apphelpers::UptimeCounter uptime;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      uptime.update(i * 997);
+      benchClobber();
+    }
+  });
+  benchRegister("UptimeCounter/getSeconds", [](unsigned long iterations) {
+    gbj_apphelpers::UptimeCounter uptime;
+    uptime.update(123456789);
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(uptime.getSeconds());
+    }
+  });
+}
+
+BENCH_SUITE(parsing)
+{
+  benchRegister("parseDateTime", [](unsigned long iterations) {
+    char strDate[] = "Dec 26 2018";
+    char strTime[] = "12:34:56";
+    gbj_apphelpers::Datetime dtRecord;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      strTime[7] = '0' + (i % 10);
+      gbj_apphelpers::parseDateTime(dtRecord, strDate, strTime);
+      benchKeep(dtRecord);
+    }
+  });
+  benchRegister("parseDateTime/flash", [](unsigned long iterations) {
+    gbj_apphelpers::Datetime dtRecord;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      gbj_apphelpers::parseDateTime(dtRecord, F("Dec 26 2018"), F("12:34:56"));
+      benchKeep(dtRecord);
+    }
+  });
+  benchRegister("parseIso8601", [](unsigned long iterations) {
+    char str[] = "2021-08-16T12:34:56.789+02:00";
+    gbj_apphelpers::Datetime dtRecord;
+    unsigned long epoch;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      str[18] = '0' + (i % 10);
+      benchKeep(gbj_apphelpers::parseIso8601(dtRecord, str, &epoch));
+      benchKeep(epoch);
+    }
+  });
+  benchRegister("parseIso8601/sscanf_reference", [](unsigned long iterations) {
+    char str[] = "2021-08-16T12:34:56.789+02:00";
+    gbj_apphelpers::Datetime dtRecord;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      str[18] = '0' + (i % 10);
+      unsigned year, month, day, hour, minute, second, ms, offH, offM;
+      char sign;
+      benchKeep(sscanf(str,
+                       "%4u-%2u-%2uT%2u:%2u:%2u.%3u%c%2u:%2u",
+                       &year,
+                       &month,
+                       &day,
+                       &hour,
+                       &minute,
+                       &second,
+                       &ms,
+                       &sign,
+                       &offH,
+                       &offM));
+      dtRecord.year = year;
+      dtRecord.month = month;
+      dtRecord.day = day;
+      dtRecord.hour = hour;
+      dtRecord.minute = minute;
+      dtRecord.second = second;
+      benchKeep(gbj_apphelpers::convertDatetime2Epoch(dtRecord));
+    }
+  });
+  benchRegister("parseRfc1123", [](unsigned long iterations) {
+    char str[] = "Sun, 06 Nov 1994 08:49:37 GMT";
+    gbj_apphelpers::Datetime dtRecord;
+    unsigned long epoch;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      str[24] = '0' + (i % 10);
+      benchKeep(gbj_apphelpers::parseRfc1123(dtRecord, str, &epoch));
+      benchKeep(epoch);
+    }
+  });
+  benchRegister("parseDateTime/constexpr", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      constexpr gbj_apphelpers::Datetime dtRecord =
+        gbj_apphelpers::parseDateTime("Dec 26 2018", "12:34:56");
+      benchKeep(dtRecord);
+    }
+  });
+}
+
+BENCH_SUITE(data_processing)
+{
+  benchRegister("check", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::check<int>(i & 1023, 100, 900));
+    }
+  });
+  benchRegister("sanitize", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::sanitize<float>(i & 1023, 500, 100, 900));
+    }
+  });
+  benchRegister("swapdata", [](unsigned long iterations) {
+    float a = 1.0, b = 2.0;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      gbj_apphelpers::swapdata(a, b);
+      benchKeep(a);
+    }
+  });
+}
+
+BENCH_SUITE(formatting)
+{
+  benchRegister("formatTimeDay", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      String text = gbj_apphelpers::formatTimeDay(i % 86400);
+      benchKeep(text);
+    }
+  });
+  benchRegister("formatTimePeriod", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      String text = gbj_apphelpers::formatTimePeriod(289025 + i);
+      benchKeep(text);
+    }
+  });
+  benchRegister("formatTimePeriodDense", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      String text = gbj_apphelpers::formatTimePeriodDense(289025 + i);
+      benchKeep(text);
+    }
+  });
+  benchRegister("formatEpochSeconds", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      String text = gbj_apphelpers::formatEpochSeconds(EPOCH + i);
+      benchKeep(text);
+    }
+  });
+  benchRegister("formatMsPeriod", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      String text = gbj_apphelpers::formatMsPeriod(289025000UL + i);
+      benchKeep(text);
+    }
+  });
+  benchRegister("formatTimeDay/buffer", [](unsigned long iterations) {
+    char buffer[gbj_apphelpers::FORMAT_TIMEDAY_LEN + 1];
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(
+        gbj_apphelpers::formatTimeDay(buffer, sizeof(buffer), i % 86400));
+      benchClobber();
+    }
+  });
+  benchRegister("formatTimePeriod/buffer", [](unsigned long iterations) {
+    char buffer[gbj_apphelpers::FORMAT_TIMEPERIOD_LEN + 1];
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(
+        gbj_apphelpers::formatTimePeriod(buffer, sizeof(buffer), 289025 + i));
+      benchClobber();
+    }
+  });
+  benchRegister("formatTimePeriodDense/buffer", [](unsigned long iterations) {
+    char buffer[gbj_apphelpers::FORMAT_TIMEPERIODDENSE_LEN + 1];
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::formatTimePeriodDense(
+        buffer, sizeof(buffer), 289025 + i));
+      benchClobber();
+    }
+  });
+  benchRegister("formatEpochSeconds/buffer", [](unsigned long iterations) {
+    char buffer[gbj_apphelpers::FORMAT_EPOCHSECONDS_LEN + 1];
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(
+        gbj_apphelpers::formatEpochSeconds(buffer, sizeof(buffer), EPOCH + i));
+      benchClobber();
+    }
+  });
+  benchRegister("EpochFormatter", [](unsigned long iterations) {
+    gbj_apphelpers::EpochFormatter formatter;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(formatter.format(EPOCH + i));
+    }
+  });
+  benchRegister("EpochFormatter/buffer", [](unsigned long iterations) {
+    gbj_apphelpers::EpochFormatter formatter;
+    char buffer[gbj_apphelpers::FORMAT_EPOCHSECONDS_LEN + 1];
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(formatter.format(buffer, sizeof(buffer), EPOCH + i));
+      benchClobber();
+    }
+  });
+  // Formatting by the standard library as before the digit pairs kernel
+  benchRegister("formatEpochSeconds/snprintf_reference",
+                [](unsigned long iterations) {
+                  char buffer[gbj_apphelpers::FORMAT_EPOCHSECONDS_LEN + 1];
+                  gbj_apphelpers::Datetime dtRecord;
+                  for (unsigned long i = 0; i < iterations; i++)
+                  {
+                    gbj_apphelpers::convertEpoch2Datetime(dtRecord, EPOCH + i);
+                    benchKeep(snprintf(buffer,
+                                       sizeof(buffer),
+                                       "%02u.%02u.%04u %02u:%02u:%02u",
+                                       dtRecord.day,
+                                       dtRecord.month,
+                                       dtRecord.year,
+                                       dtRecord.hour,
+                                       dtRecord.minute,
+                                       dtRecord.second));
+                    benchClobber();
+                  }
+                });
+  benchRegister("formatTimePeriod/snprintf_reference",
+                [](unsigned long iterations) {
+                  char buffer[gbj_apphelpers::FORMAT_TIMEPERIOD_LEN + 1];
+                  for (unsigned long i = 0; i < iterations; i++)
+                  {
+                    unsigned long total = 289025 + i;
+                    benchKeep(snprintf(buffer,
+                                       sizeof(buffer),
+                                       "%lud %uh %um %us",
+                                       total / 86400,
+                                       static_cast<unsigned>(total / 3600 % 24),
+                                       static_cast<unsigned>(total / 60 % 60),
+                                       static_cast<unsigned>(total % 60)));
+                    benchClobber();
+                  }
+                });
+  benchRegister("formatMsPeriod/buffer", [](unsigned long iterations) {
+    char buffer[gbj_apphelpers::FORMAT_TIMEPERIOD_LEN + 1];
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::formatMsPeriod(
+        buffer, sizeof(buffer), 289025000UL + i));
+      benchClobber();
+    }
+  });
+}
+
+BENCH_SUITE(utilities)
+{
+  benchRegister("debounce", [](unsigned long iterations) {
+    hostPinSet(2, HIGH);
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::debounce(i & 1, 2));
+    }
+  });
+  benchRegister("debounce/pins12", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      for (uint8_t pin = 2; pin < 14; pin++)
+      {
+        benchKeep(gbj_apphelpers::debounce(i & 1, pin));
+      }
+    }
+  });
+  benchRegister("Debouncer/update/pins12", [](unsigned long iterations) {
+    static const uint8_t pins[] = { 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13 };
+    gbj_apphelpers::Debouncer<12> inputs(pins, 0, 0);
+    inputs.begin();
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(inputs.update());
+    }
+  });
+  benchRegister("Debouncer/tick/inputs32", [](unsigned long iterations) {
+    static const uint8_t pins[32] = { 0 };
+    gbj_apphelpers::Debouncer<32> inputs(pins);
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(inputs.tick(i & 0x1F ? 0x0F0F0F0F : 0xFFFF0000));
+    }
+  });
+}
@@ -0,0 +1,68 @@
+/*
+  NAME:
+  Benchmarks of library "gbj_apphelpers" smoothing filters.
+
+  DESCRIPTION:
+  The suite compares smoothing of integer samples by filters in integer
+  arithmetic with their float specializations and a hand-made float
+  exponential moving average with arbitrary coefficient. On hosts with FPU
+  the float ones can be faster, the comparison is relevant for
+  microcontrollers emulating floating point arithmetic.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include "bench.h"
+#include <gbj_apphelpers.h>
+
+namespace
+{
+  inline int16_t sample(unsigned long i)
+  {
+    return 512 + static_cast<int16_t>((i * 2654435761UL) % 101);
+  }
+}
+
+BENCH_SUITE(filters)
+{
+  benchRegister("FilterEma/int16", [](unsigned long iterations) {
+    gbj_apphelpers::FilterEma<int16_t, 3> filter;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(filter.add(sample(i)));
+    }
+  });
+  benchRegister("FilterEma/float", [](unsigned long iterations) {
+    gbj_apphelpers::FilterEma<float, 3> filter;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(filter.add(sample(i)));
+    }
+  });
+  benchRegister("FilterEma/float_reference", [](unsigned long iterations) {
+    float value = sample(0);
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      value = 0.12f * sample(i) + 0.88f * value;
+      benchKeep(static_cast<int16_t>(value + 0.5f));
+    }
+  });
+  benchRegister("FilterIir2/int16", [](unsigned long iterations) {
+    gbj_apphelpers::FilterIir2<int16_t, 3, 2> filter;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(filter.add(sample(i)));
+    }
+  });
+  benchRegister("FilterIir2/float", [](unsigned long iterations) {
+    gbj_apphelpers::FilterIir2<float, 3, 2> filter;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(filter.add(sample(i)));
+    }
+  });
+}
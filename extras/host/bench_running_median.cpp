@@ -0,0 +1,82 @@
+/*
+  NAME:
+  Benchmarks of library "gbj_apphelpers" running median filter.
+
+  DESCRIPTION:
+  The suite compares updating running median by a new sample with copying
+  the window and sorting it by the original buble sorting on every sample.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include "bench.h"
+#include <gbj_apphelpers.h>
+
+namespace
+{
+  inline float sample(unsigned long i)
+  {
+    return 21.5 + static_cast<float>((i * 2654435761UL) % 101) / 100;
+  }
+
+  template<uint16_t W>
+  void registerWindow()
+  {
+    std::string size = "/" + std::to_string(W);
+    benchRegister("RunningMedian" + size, [](unsigned long iterations) {
+      gbj_apphelpers::RunningMedian<float, W> filter;
+      for (unsigned long i = 0; i < iterations; i++)
+      {
+        benchKeep(filter.add(sample(i)));
+      }
+    });
+    benchRegister("RunningMedian/copy_sort_buble" + size,
+                  [](unsigned long iterations) {
+                    float history[W] = {};
+                    float window[W];
+                    for (unsigned long i = 0; i < iterations; i++)
+                    {
+                      history[i % W] = sample(i);
+                      memcpy(window, history, sizeof(window));
+                      // Original buble sorting
+                      bool again = true;
+                      for (uint16_t k = 0; k < W - 1 && again; k++)
+                      {
+                        again = false;
+                        for (uint16_t j = W - 1; j > k; --j)
+                        {
+                          if (window[j] < window[j - 1])
+                          {
+                            gbj_apphelpers::swapdata(window[j], window[j - 1]);
+                            again = true;
+                          }
+                        }
+                      }
+                      benchKeep(window[W / 2]);
+                    }
+                  });
+    benchRegister("RunningMedian/copy_median" + size,
+                  [](unsigned long iterations) {
+                    float history[W] = {};
+                    float window[W];
+                    for (unsigned long i = 0; i < iterations; i++)
+                    {
+                      history[i % W] = sample(i);
+                      memcpy(window, history, sizeof(window));
+                      benchKeep(gbj_apphelpers::median(window, W));
+                    }
+                  });
+  }
+}
+
+BENCH_SUITE(running_median)
+{
+  registerWindow<5>();
+  registerWindow<15>();
+  registerWindow<63>();
+  registerWindow<255>();
+}
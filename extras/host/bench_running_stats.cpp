@@ -0,0 +1,87 @@
+/*
+  NAME:
+  Benchmarks of library "gbj_apphelpers" running statistics.
+
+  DESCRIPTION:
+  The suite compares updating running mean, variance, minimum, and maximum
+  by a new sample with recalculating them from the whole window on every
+  sample.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include "bench.h"
+#include <gbj_apphelpers.h>
+
+namespace
+{
+  inline int16_t sample(unsigned long i)
+  {
+    return 2150 + static_cast<int16_t>((i * 2654435761UL) % 101);
+  }
+
+  struct Summary
+  {
+    double mean;
+    double variance;
+    int16_t valMin;
+    int16_t valMax;
+  };
+
+  template<uint16_t W>
+  void registerWindow()
+  {
+    std::string size = "/" + std::to_string(W);
+    benchRegister("RunningStats" + size, [](unsigned long iterations) {
+      gbj_apphelpers::RunningStats<int16_t, W> stats;
+      for (unsigned long i = 0; i < iterations; i++)
+      {
+        stats.add(sample(i));
+        Summary summary = {
+          stats.getMean(), stats.getVariance(), stats.getMin(), stats.getMax()
+        };
+        benchKeep(summary);
+      }
+    });
+    benchRegister("RunningStats/recalculate" + size,
+                  [](unsigned long iterations) {
+                    int16_t history[W] = {};
+                    for (unsigned long i = 0; i < iterations; i++)
+                    {
+                      history[i % W] = sample(i);
+                      Summary summary = { 0, 0, history[0], history[0] };
+                      for (uint16_t j = 0; j < W; j++)
+                      {
+                        summary.mean += history[j];
+                        if (history[j] < summary.valMin)
+                        {
+                          summary.valMin = history[j];
+                        }
+                        if (history[j] > summary.valMax)
+                        {
+                          summary.valMax = history[j];
+                        }
+                      }
+                      summary.mean /= W;
+                      for (uint16_t j = 0; j < W; j++)
+                      {
+                        double delta = history[j] - summary.mean;
+                        summary.variance += delta * delta;
+                      }
+                      summary.variance /= W - 1;
+                      benchKeep(summary);
+                    }
+                  });
+  }
+}
+
+BENCH_SUITE(running_stats)
+{
+  registerWindow<16>();
+  registerWindow<60>();
+  registerWindow<256>();
+}
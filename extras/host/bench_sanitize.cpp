@@ -0,0 +1,99 @@
+/*
+  NAME:
+  Benchmarks of library "gbj_apphelpers" range checking of data buffers.
+
+  DESCRIPTION:
+  The suite compares sanitizing a data buffer by the scalar method in a loop
+  with sanitizing it by the array method with and without bitmask.
+  - Every iteration includes copying the source into the processed buffer.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include "bench.h"
+#include <gbj_apphelpers.h>
+#include <vector>
+
+namespace
+{
+  const size_t SIZE = 1024;
+
+  template<class T>
+  std::vector<T> readings()
+  {
+    std::vector<T> source(SIZE);
+    for (size_t i = 0; i < SIZE; i++)
+    {
+      // Every 7th reading is out of range
+      source[i] = static_cast<T>(i % 7 ? (i * 37) % 100 : 1000);
+    }
+    return source;
+  }
+
+  template<class T>
+  void registerSanitize(const std::string &type)
+  {
+    std::vector<T> source = readings<T>();
+    std::string suffix = "/" + type + "/" + std::to_string(SIZE);
+    benchRegister("sanitize/loop" + suffix,
+                  [source](unsigned long iterations) {
+                    std::vector<T> buffer(source.size());
+                    for (unsigned long i = 0; i < iterations; i++)
+                    {
+                      memcpy(buffer.data(),
+                             source.data(),
+                             source.size() * sizeof(T));
+                      for (size_t j = 0; j < buffer.size(); j++)
+                      {
+                        buffer[j] =
+                          gbj_apphelpers::sanitize<T>(buffer[j], 50, 0, 99);
+                      }
+                      benchClobber();
+                    }
+                  });
+    benchRegister("sanitizeArray" + suffix,
+                  [source](unsigned long iterations) {
+                    std::vector<T> buffer(source.size());
+                    for (unsigned long i = 0; i < iterations; i++)
+                    {
+                      memcpy(buffer.data(),
+                             source.data(),
+                             source.size() * sizeof(T));
+                      benchKeep(gbj_apphelpers::sanitizeArray<T>(
+                        buffer.data(), buffer.size(), 50, 0, 99));
+                    }
+                  });
+    benchRegister("sanitizeArray/mask" + suffix,
+                  [source](unsigned long iterations) {
+                    std::vector<T> buffer(source.size());
+                    uint8_t mask[SIZE / 8];
+                    for (unsigned long i = 0; i < iterations; i++)
+                    {
+                      memcpy(buffer.data(),
+                             source.data(),
+                             source.size() * sizeof(T));
+                      benchKeep(gbj_apphelpers::sanitizeArray<T>(
+                        buffer.data(), buffer.size(), 50, 0, 99, mask));
+                    }
+                  });
+    benchRegister("checkArray" + suffix, [source](unsigned long iterations) {
+      for (unsigned long i = 0; i < iterations; i++)
+      {
+        benchKeep(
+          gbj_apphelpers::checkArray<T>(source.data(), source.size(), 0, 99));
+        benchClobber();
+      }
+    });
+  }
+}
+
+BENCH_SUITE(sanitizing)
+{
+  registerSanitize<float>("float");
+  registerSanitize<int16_t>("int16");
+  registerSanitize<int32_t>("int32");
+}
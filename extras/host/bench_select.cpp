@@ -0,0 +1,67 @@
+/*
+  NAME:
+  Benchmarks of library "gbj_apphelpers" selection methods.
+
+  DESCRIPTION:
+  The suite compares median determined by selection with median determined
+  by full sorting for buffer sizes from 8 to 4096 items.
+  - Every iteration includes copying the unsorted source into the processed
+    buffer, which is negligible against selecting itself.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include "bench.h"
+#include <gbj_apphelpers.h>
+#include <vector>
+
+namespace
+{
+  float medianSorted(float *dataBuffer, size_t dataLen)
+  {
+    gbj_apphelpers::sort_asc(dataBuffer, dataLen);
+    return dataBuffer[dataLen / 2];
+  }
+
+  float percentile95(float *dataBuffer, size_t dataLen)
+  {
+    return gbj_apphelpers::percentile(dataBuffer, dataLen, 95);
+  }
+
+  void registerSelect(const char *name,
+                      float (*selector)(float *, size_t),
+                      size_t size)
+  {
+    std::vector<float> source(size);
+    for (size_t i = 0; i < size; i++)
+    {
+      // Noisy thermometer readings around 21.5 centigrades
+      source[i] = 21.5 + static_cast<float>((i * 2654435761UL) % 101) / 100;
+    }
+    benchRegister(std::string(name) + "/" + std::to_string(size),
+                  [source, selector](unsigned long iterations) {
+                    std::vector<float> buffer(source.size());
+                    for (unsigned long i = 0; i < iterations; i++)
+                    {
+                      memcpy(buffer.data(),
+                             source.data(),
+                             source.size() * sizeof(float));
+                      benchKeep(selector(buffer.data(), buffer.size()));
+                    }
+                  });
+  }
+}
+
+BENCH_SUITE(selection)
+{
+  for (size_t size = 8; size <= 4096; size *= 2)
+  {
+    registerSelect("median/sort_asc", medianSorted, size);
+    registerSelect("median", gbj_apphelpers::median<float>, size);
+    registerSelect("percentile/95", percentile95, size);
+  }
+}
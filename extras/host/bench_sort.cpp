@@ -0,0 +1,89 @@
+/*
+  NAME:
+  Benchmarks of library "gbj_apphelpers" sorting methods.
+
+  DESCRIPTION:
+  The suite compares introspective and stable sorting with the original
+  buble sorting for buffer sizes from 8 to 4096 items.
+  - The original buble sorting is kept here as a reference implementation.
+  - Every iteration includes copying the unsorted source into the sorted
+    buffer, which is negligible against sorting itself.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include "bench.h"
+#include <gbj_apphelpers.h>
+#include <vector>
+
+namespace
+{
+  // Original buble sorting of the library up to version 1.12.0
+  template<class T>
+  void sortBubleReference(T *dataBuffer, size_t dataLen)
+  {
+    bool again = true;
+    for (size_t i = 0; i + 1 < dataLen && again; i++)
+    {
+      again = false;
+      for (size_t j = dataLen - 1; j > i; --j)
+      {
+        if (dataBuffer[j] < dataBuffer[j - 1])
+        {
+          gbj_apphelpers::swapdata(dataBuffer[j], dataBuffer[j - 1]);
+          again = true;
+        }
+      }
+    }
+  }
+
+  template<class T>
+  void registerSort(const char *name,
+                    void (*sorter)(T *, size_t),
+                    size_t size)
+  {
+    std::vector<T> source(size);
+    for (size_t i = 0; i < size; i++)
+    {
+      // Deterministic pseudo-random values
+      source[i] = static_cast<T>((i * 2654435761UL) % 10007);
+    }
+    benchRegister(std::string(name) + "/" + std::to_string(size),
+                  [source, sorter](unsigned long iterations) {
+                    std::vector<T> buffer(source.size());
+                    for (unsigned long i = 0; i < iterations; i++)
+                    {
+                      memcpy(buffer.data(),
+                             source.data(),
+                             source.size() * sizeof(T));
+                      sorter(buffer.data(), buffer.size());
+                      benchClobber();
+                    }
+                  });
+  }
+}
+
+BENCH_SUITE(sorting)
+{
+  for (size_t size = 8; size <= 4096; size *= 2)
+  {
+    registerSort<float>("sort/buble_reference", sortBubleReference<float>, size);
+    registerSort<float>("sort_asc", gbj_apphelpers::sort_asc<float>, size);
+    registerSort<float>(
+      "sort_stable_asc", gbj_apphelpers::sort_stable_asc<float>, size);
+  }
+  registerSort<float>("sort_buble_asc",
+                      [](float *dataBuffer, size_t dataLen) {
+                        gbj_apphelpers::sort_buble_asc(dataBuffer, dataLen);
+                      },
+                      512);
+  registerSort<float>("sort_buble_desc",
+                      [](float *dataBuffer, size_t dataLen) {
+                        gbj_apphelpers::sort_buble_desc(dataBuffer, dataLen);
+                      },
+                      512);
+}
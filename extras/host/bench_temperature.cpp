@@ -0,0 +1,207 @@
+/*
+  NAME:
+  Benchmarks of library "gbj_apphelpers" batch temperature calculations.
+
+  DESCRIPTION:
+  The suite compares converting temperatures and calculating dew points of
+  a buffer by the scalar methods in a loop with the array methods.
+  - Fused psychrometric calculation is compared with calling particular
+    methods for each quantity.
+  - Fixed point variants are compared with floating point methods. On hosts
+    with FPU the floating point ones can be faster, the comparison is
+    relevant for microcontrollers emulating floating point arithmetic.
+  - Conversions of quantities with compile time units are compared with
+    the particular conversion methods.
+  - Time per operation relates to the whole buffer, so that throughput in
+    items per nanosecond is the size of the buffer divided by it.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include "bench.h"
+#include <gbj_apphelpers.h>
+#include <vector>
+
+namespace
+{
+  const size_t SIZE = 1024;
+
+  void registerConversion(const std::string &name,
+                          float (*scalar)(float),
+                          void (*array)(const float *, float *, size_t))
+  {
+    std::vector<float> source(SIZE);
+    for (size_t i = 0; i < SIZE; i++)
+    {
+      source[i] = -40.0 + 0.13 * i;
+    }
+    std::string suffix = "/" + std::to_string(SIZE);
+    benchRegister(name + "/loop" + suffix,
+                  [source, scalar](unsigned long iterations) {
+                    std::vector<float> result(source.size());
+                    for (unsigned long i = 0; i < iterations; i++)
+                    {
+                      for (size_t j = 0; j < source.size(); j++)
+                      {
+                        result[j] = scalar(source[j]);
+                      }
+                      benchClobber();
+                    }
+                  });
+    benchRegister(name + "Array" + suffix,
+                  [source, array](unsigned long iterations) {
+                    std::vector<float> result(source.size());
+                    for (unsigned long i = 0; i < iterations; i++)
+                    {
+                      array(source.data(), result.data(), source.size());
+                      benchClobber();
+                    }
+                  });
+  }
+}
+
+BENCH_SUITE(temperature)
+{
+  registerConversion("convertCelsius2Fahrenheit",
+                     gbj_apphelpers::convertCelsius2Fahrenheit,
+                     gbj_apphelpers::convertCelsius2FahrenheitArray);
+  registerConversion("convertFahrenheit2Celsius",
+                     gbj_apphelpers::convertFahrenheit2Celsius,
+                     gbj_apphelpers::convertFahrenheit2CelsiusArray);
+
+  std::vector<float> rhum(SIZE);
+  std::vector<float> temp(SIZE);
+  for (size_t i = 0; i < SIZE; i++)
+  {
+    rhum[i] = 5.0 + (i * 37) % 95;
+    temp[i] = -20.0 + 0.05 * i;
+  }
+  std::string suffix = "/" + std::to_string(SIZE);
+  benchRegister("calculateDewpoint/loop" + suffix,
+                [rhum, temp](unsigned long iterations) {
+                  std::vector<float> result(rhum.size());
+                  for (unsigned long i = 0; i < iterations; i++)
+                  {
+                    for (size_t j = 0; j < rhum.size(); j++)
+                    {
+                      result[j] =
+                        gbj_apphelpers::calculateDewpoint(rhum[j], temp[j]);
+                    }
+                    benchClobber();
+                  }
+                });
+  benchRegister("calculateDewpointArray" + suffix,
+                [rhum, temp](unsigned long iterations) {
+                  std::vector<float> result(rhum.size());
+                  for (unsigned long i = 0; i < iterations; i++)
+                  {
+                    benchKeep(gbj_apphelpers::calculateDewpointArray(
+                      rhum.data(), temp.data(), result.data(), rhum.size()));
+                  }
+                });
+  benchRegister("calculatePsychrometrics", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::calculatePsychrometrics(30.0 + (i & 63),
+                                                        15.0 + (i & 15)));
+    }
+  });
+  benchRegister("calculatePsychrometrics/particular",
+                [](unsigned long iterations) {
+                  for (unsigned long i = 0; i < iterations; i++)
+                  {
+                    float rhum = 30.0 + (i & 63);
+                    float temp = 15.0 + (i & 15);
+                    gbj_apphelpers::Psychrometrics air;
+                    air.dewpoint =
+                      gbj_apphelpers::calculateDewpoint(rhum, temp);
+                    air.heatIndex =
+                      gbj_apphelpers::calculateHeatIndex(rhum, temp);
+                    air.absoluteHumidity =
+                      gbj_apphelpers::calculateAbsoluteHumidity(rhum, temp);
+                    air.humidex = gbj_apphelpers::calculateHumidex(rhum, temp);
+                    benchKeep(air);
+                  }
+                });
+  benchRegister("convertCelsius2FahrenheitFixed",
+                [](unsigned long iterations) {
+                  for (unsigned long i = 0; i < iterations; i++)
+                  {
+                    benchKeep(gbj_apphelpers::convertCelsius2FahrenheitFixed(
+                      (i & 8191) - 4000));
+                  }
+                });
+  benchRegister("calculateDewpointFixed", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::calculateDewpointFixed(300 + (i & 511),
+                                                       1500 + (i & 1023)));
+    }
+  });
+  benchRegister("calculateAltitudeFromPressures",
+                [](unsigned long iterations) {
+                  for (unsigned long i = 0; i < iterations; i++)
+                  {
+                    benchKeep(gbj_apphelpers::calculateAltitudeFromPressures(
+                      90000.0 + (i & 8191), 101325.0));
+                  }
+                });
+  benchRegister("calculateAltitudeFromPressuresFixed",
+                [](unsigned long iterations) {
+                  for (unsigned long i = 0; i < iterations; i++)
+                  {
+                    benchKeep(
+                      gbj_apphelpers::calculateAltitudeFromPressuresFixed(
+                        90000 + (i & 8191), 101325));
+                  }
+                });
+  benchRegister("calculatePressureSeaFromAltitude",
+                [](unsigned long iterations) {
+                  for (unsigned long i = 0; i < iterations; i++)
+                  {
+                    benchKeep(gbj_apphelpers::calculatePressureSeaFromAltitude(
+                      90000.0, (i & 1023)));
+                  }
+                });
+  benchRegister("calculatePressureSeaFromAltitudeFixed",
+                [](unsigned long iterations) {
+                  for (unsigned long i = 0; i < iterations; i++)
+                  {
+                    benchKeep(
+                      gbj_apphelpers::calculatePressureSeaFromAltitudeFixed(
+                        90000, (i & 1023) * 100));
+                  }
+                });
+  benchRegister("convertUnit/Celsius2Fahrenheit", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::convertUnit<gbj_apphelpers::UnitCelsius,
+                                            gbj_apphelpers::UnitFahrenheit>(
+        static_cast<float>(i & 127)));
+    }
+  });
+  benchRegister("Quantity/MillimeterMercury2InchMercury",
+                [](unsigned long iterations) {
+                  for (unsigned long i = 0; i < iterations; i++)
+                  {
+                    gbj_apphelpers::Quantity<
+                      gbj_apphelpers::UnitMillimeterMercury>
+                      pressure(700.0 + (i & 127));
+                    gbj_apphelpers::Quantity<gbj_apphelpers::UnitInchMercury>
+                      pressureIn = pressure;
+                    benchKeep(pressureIn);
+                  }
+                });
+  benchRegister("convertUnit/Millisecond2Second", [](unsigned long iterations) {
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      benchKeep(gbj_apphelpers::convertUnit<gbj_apphelpers::UnitMillisecond,
+                                            gbj_apphelpers::UnitSecond>(
+        static_cast<uint32_t>(i)));
+    }
+  });
+}
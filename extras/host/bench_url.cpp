@@ -0,0 +1,121 @@
+/*
+  NAME:
+  Benchmarks of library "gbj_apphelpers" URL encoding.
+
+  DESCRIPTION:
+  The suite compares the table driven URL encoding in all encoding modes
+  with the original encoding of the library for a payload of about 2 KiB.
+  - The original encoding is kept here as a reference implementation.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include "bench.h"
+#include <gbj_apphelpers.h>
+
+namespace
+{
+  // Original URL encoding of the library up to version 1.12.0
+  String urlencodeReference(String str)
+  {
+    String encodedString = "";
+    char c;
+    char code0;
+    char code1;
+    for (word i = 0; i < str.length(); i++)
+    {
+      c = str.charAt(i);
+      if (c == ' ')
+      {
+        encodedString += '+';
+      }
+      else if (isalnum(c))
+      {
+        encodedString += c;
+      }
+      else
+      {
+        code1 = (c & 0xf) + '0';
+        if ((c & 0xf) > 9)
+        {
+          code1 = (c & 0xf) - 10 + 'A';
+        }
+        c = (c >> 4) & 0xf;
+        code0 = c + '0';
+        if (c > 9)
+        {
+          code0 = c - 10 + 'A';
+        }
+        encodedString += '%';
+        encodedString += code0;
+        encodedString += code1;
+      }
+      yield();
+    }
+    return encodedString;
+  }
+
+  class NullSink : public Print
+  {
+  public:
+    size_t write(uint8_t c) { return 1; }
+    size_t write(const uint8_t *buffer, size_t size)
+    {
+      benchKeep(buffer);
+      return size;
+    }
+  };
+
+  // Google Sheets like payload with sensor readings and timestamps
+  String payload()
+  {
+    String text = "";
+    for (int i = 0; i < 32; i++)
+    {
+      text += "sample_time=2021-08-16T12:34:56&temperature=23.45&humidity=55.1;";
+    }
+    return text;
+  }
+
+  void registerUrlencode(const char *name, gbj_apphelpers::UrlModes mode)
+  {
+    benchRegister(std::string("urlencode/") + name,
+                  [mode](unsigned long iterations) {
+                    String str = payload();
+                    for (unsigned long i = 0; i < iterations; i++)
+                    {
+                      String text = gbj_apphelpers::urlencode(str, mode);
+                      benchKeep(text);
+                    }
+                  });
+    benchRegister(std::string("urlencode/sink/") + name,
+                  [mode](unsigned long iterations) {
+                    String str = payload();
+                    NullSink sink;
+                    for (unsigned long i = 0; i < iterations; i++)
+                    {
+                      benchKeep(gbj_apphelpers::urlencode(
+                        sink, str.c_str(), str.length(), mode));
+                    }
+                  });
+  }
+}
+
+BENCH_SUITE(url_coding)
+{
+  benchRegister("urlencode/reference", [](unsigned long iterations) {
+    String str = payload();
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+      String text = urlencodeReference(str);
+      benchKeep(text);
+    }
+  });
+  registerUrlencode("alnum", gbj_apphelpers::URLMODE_ALNUM);
+  registerUrlencode("form", gbj_apphelpers::URLMODE_FORM);
+  registerUrlencode("rfc3986", gbj_apphelpers::URLMODE_RFC3986);
+}
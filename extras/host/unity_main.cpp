@@ -0,0 +1,28 @@
+/*
+  NAME:
+  Host runner of Unity test suites of library "gbj_apphelpers".
+
+  DESCRIPTION:
+  The runner calls the Arduino style setup() function of a test suite, which
+  executes all its test cases, and returns nonzero exit code on failures.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include <Arduino.h>
+#include <unity.h>
+
+void setup();
+
+extern "C" __attribute__((weak)) void setUp(void) {}
+extern "C" __attribute__((weak)) void tearDown(void) {}
+
+int main()
+{
+  setup();
+  return Unity.TestFailures ? 1 : 0;
+}
@@ -39,6 +39,40 @@ void test_negative(void)
     }
 }
 
+void test_constexpr(void)
+{
+    static_assert(gbj_apphelpers::calculateDigits(UINT32_MAX) == 10, "");
+    static_assert(gbj_apphelpers::calculateDigits(UINT64_MAX) == 20, "");
+    char buffer[gbj_apphelpers::calculateDigits(65535U) + 1];
+    TEST_ASSERT_EQUAL_UINT8(6, sizeof(buffer));
+}
+
+void test_powers(void)
+{
+    uint64_t power = 1;
+    for (byte i = 1; i <= 19; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT8(i, gbj_apphelpers::calculateDigits(power));
+        TEST_ASSERT_EQUAL_UINT8(i, gbj_apphelpers::calculateDigits(power * 9));
+        TEST_ASSERT_EQUAL_UINT8(i + 1,
+                                gbj_apphelpers::calculateDigits(power * 10));
+        TEST_ASSERT_EQUAL_UINT8(i, gbj_apphelpers::calculateDigits(power * 10 - 1));
+        power *= 10;
+    }
+}
+
+void test_widths(void)
+{
+    TEST_ASSERT_EQUAL_UINT8(3, gbj_apphelpers::calculateDigits(uint8_t(255)));
+    TEST_ASSERT_EQUAL_UINT8(3, gbj_apphelpers::calculateDigits(int8_t(-128)));
+    TEST_ASSERT_EQUAL_UINT8(5, gbj_apphelpers::calculateDigits(int16_t(-32768)));
+    TEST_ASSERT_EQUAL_UINT8(10, gbj_apphelpers::calculateDigits(INT32_MIN));
+    TEST_ASSERT_EQUAL_UINT8(1, gbj_apphelpers::calculateDigits(-1));
+    TEST_ASSERT_EQUAL_UINT8(19, gbj_apphelpers::calculateDigits(INT64_MIN));
+    TEST_ASSERT_EQUAL_UINT8(19, gbj_apphelpers::calculateDigits(INT64_MAX));
+    TEST_ASSERT_EQUAL_UINT8(20, gbj_apphelpers::calculateDigits(UINT64_MAX));
+}
+
 
 void setup() {
     UNITY_BEGIN();
@@ -46,6 +80,9 @@ void setup() {
     RUN_TEST(test_zero);
     RUN_TEST(test_positive);
     RUN_TEST(test_negative);
+    RUN_TEST(test_constexpr);
+    RUN_TEST(test_powers);
+    RUN_TEST(test_widths);
 
     UNITY_END();
 }
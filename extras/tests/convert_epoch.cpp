@@ -0,0 +1,133 @@
+/*
+  NAME:
+  Unit tests of library "gbj_apphelpers" for epoch time conversions.
+
+  DESCRIPTION:
+  The test suite provides test cases related to conversion of unix epoch time
+  to datetime record and back.
+  - The test runner is Unity Project - ThrowTheSwitch.org.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include <Arduino.h>
+#include <unity.h>
+#include <gbj_apphelpers.h>
+
+gbj_apphelpers::Datetime dtRecord;
+
+void test_epoch_start(void)
+{
+  gbj_apphelpers::convertEpoch2Datetime(dtRecord, 0);
+  TEST_ASSERT_EQUAL_INT(1970, dtRecord.year);
+  TEST_ASSERT_EQUAL_INT(1, dtRecord.month);
+  TEST_ASSERT_EQUAL_INT(1, dtRecord.day);
+  TEST_ASSERT_EQUAL_INT(0, dtRecord.hour);
+  TEST_ASSERT_EQUAL_INT(0, dtRecord.minute);
+  TEST_ASSERT_EQUAL_INT(0, dtRecord.second);
+  // Thursday
+  TEST_ASSERT_EQUAL_INT(4, dtRecord.weekday);
+}
+
+void test_epoch_leap_day(void)
+{
+  // 29.02.2024 23:59:59
+  gbj_apphelpers::convertEpoch2Datetime(dtRecord, 1709251199UL);
+  TEST_ASSERT_EQUAL_INT(2024, dtRecord.year);
+  TEST_ASSERT_EQUAL_INT(2, dtRecord.month);
+  TEST_ASSERT_EQUAL_INT(29, dtRecord.day);
+  TEST_ASSERT_EQUAL_INT(23, dtRecord.hour);
+  TEST_ASSERT_EQUAL_INT(59, dtRecord.minute);
+  TEST_ASSERT_EQUAL_INT(59, dtRecord.second);
+  TEST_ASSERT_TRUE(dtRecord.pm);
+  // Thursday
+  TEST_ASSERT_EQUAL_INT(4, dtRecord.weekday);
+  gbj_apphelpers::convertEpoch2Datetime(dtRecord, 1709251200UL);
+  TEST_ASSERT_EQUAL_INT(3, dtRecord.month);
+  TEST_ASSERT_EQUAL_INT(1, dtRecord.day);
+  TEST_ASSERT_EQUAL_INT(5, dtRecord.weekday);
+}
+
+void test_epoch_end(void)
+{
+  // 07.02.2106 06:28:15
+  gbj_apphelpers::convertEpoch2Datetime(dtRecord, 4294967295UL);
+  TEST_ASSERT_EQUAL_INT(2106, dtRecord.year);
+  TEST_ASSERT_EQUAL_INT(2, dtRecord.month);
+  TEST_ASSERT_EQUAL_INT(7, dtRecord.day);
+  TEST_ASSERT_EQUAL_INT(6, dtRecord.hour);
+  TEST_ASSERT_EQUAL_INT(28, dtRecord.minute);
+  TEST_ASSERT_EQUAL_INT(15, dtRecord.second);
+  // Sunday
+  TEST_ASSERT_EQUAL_INT(7, dtRecord.weekday);
+}
+
+void test_datetime_epoch(void)
+{
+  dtRecord = gbj_apphelpers::Datetime();
+  dtRecord.year = 2021;
+  dtRecord.month = 8;
+  dtRecord.day = 16;
+  dtRecord.hour = 12;
+  dtRecord.minute = 34;
+  dtRecord.second = 56;
+  TEST_ASSERT_EQUAL_UINT32(1629117296UL,
+                           gbj_apphelpers::convertDatetime2Epoch(dtRecord));
+  // Two-digit year
+  dtRecord.year = 21;
+  TEST_ASSERT_EQUAL_UINT32(1629117296UL,
+                           gbj_apphelpers::convertDatetime2Epoch(dtRecord));
+  // Before the epoch
+  dtRecord.year = 1969;
+  TEST_ASSERT_EQUAL_UINT32(0, gbj_apphelpers::convertDatetime2Epoch(dtRecord));
+}
+
+void test_datetime_epoch_12h(void)
+{
+  dtRecord = gbj_apphelpers::Datetime();
+  dtRecord.year = 2021;
+  dtRecord.month = 8;
+  dtRecord.day = 16;
+  dtRecord.mode12h = true;
+  dtRecord.hour = 12;
+  dtRecord.pm = false;
+  TEST_ASSERT_EQUAL_UINT32(1629072000UL,
+                           gbj_apphelpers::convertDatetime2Epoch(dtRecord));
+  dtRecord.pm = true;
+  TEST_ASSERT_EQUAL_UINT32(1629072000UL + 12 * 3600UL,
+                           gbj_apphelpers::convertDatetime2Epoch(dtRecord));
+  dtRecord.hour = 11;
+  TEST_ASSERT_EQUAL_UINT32(1629072000UL + 23 * 3600UL,
+                           gbj_apphelpers::convertDatetime2Epoch(dtRecord));
+}
+
+void test_round_trip(void)
+{
+  // Step through whole epoch range with a prime step
+  for (unsigned long epoch = 0; epoch < 4294000000UL; epoch += 999983UL)
+  {
+    gbj_apphelpers::convertEpoch2Datetime(dtRecord, epoch);
+    TEST_ASSERT_EQUAL_UINT32(epoch,
+                             gbj_apphelpers::convertDatetime2Epoch(dtRecord));
+  }
+}
+
+void setup()
+{
+  UNITY_BEGIN();
+
+  RUN_TEST(test_epoch_start);
+  RUN_TEST(test_epoch_leap_day);
+  RUN_TEST(test_epoch_end);
+  RUN_TEST(test_datetime_epoch);
+  RUN_TEST(test_datetime_epoch_12h);
+  RUN_TEST(test_round_trip);
+
+  UNITY_END();
+}
+
+void loop() {}
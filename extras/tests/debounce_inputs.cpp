@@ -0,0 +1,180 @@
+/*
+  NAME:
+  Unit tests of library "gbj_apphelpers" for debouncing of inputs.
+
+  DESCRIPTION:
+  The test suite provides test cases related to non-blocking debouncing of
+  multiple inputs by vertical counters.
+  - Digital pins and milliseconds timer are simulated by the host Arduino
+    core.
+  - The test runner is Unity Project - ThrowTheSwitch.org.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include <Arduino.h>
+#include <gbj_apphelpers.h>
+#include <unity.h>
+
+const uint8_t PINS[] = { 2, 3, 4 };
+
+void setUp(void)
+{
+  hostClockSet(1000);
+  for (uint8_t i = 0; i < sizeof(PINS); i++)
+  {
+    hostPinSet(PINS[i], LOW);
+  }
+}
+
+void tearDown(void)
+{
+  hostClockRelease();
+}
+
+void test_debounce_steady(void)
+{
+  gbj_apphelpers::Debouncer<3> inputs(PINS);
+  hostPinSet(3, HIGH);
+  inputs.begin();
+  TEST_ASSERT_EQUAL_HEX32(0b010, inputs.getState());
+  TEST_ASSERT_TRUE(inputs.isActive(1));
+  // Change is accepted at the fourth sample
+  hostPinSet(2, HIGH);
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    hostClockAdvance(5);
+    TEST_ASSERT_FALSE(inputs.update());
+    TEST_ASSERT_EQUAL_HEX32(0b010, inputs.getState());
+  }
+  hostClockAdvance(5);
+  TEST_ASSERT_TRUE(inputs.update());
+  TEST_ASSERT_EQUAL_HEX32(0b011, inputs.getState());
+  TEST_ASSERT_EQUAL_HEX32(0b001, inputs.getPressed());
+  TEST_ASSERT_EQUAL_HEX32(0, inputs.getReleased());
+  // Edges are reported just once
+  hostClockAdvance(5);
+  TEST_ASSERT_FALSE(inputs.update());
+  TEST_ASSERT_EQUAL_HEX32(0, inputs.getPressed());
+}
+
+void test_debounce_bounce(void)
+{
+  gbj_apphelpers::Debouncer<3> inputs(PINS);
+  inputs.begin();
+  // Bounce resets the counter
+  const uint8_t levels[] = { HIGH, HIGH, LOW, HIGH, HIGH, HIGH };
+  for (uint8_t i = 0; i < sizeof(levels); i++)
+  {
+    hostPinSet(4, levels[i]);
+    hostClockAdvance(5);
+    TEST_ASSERT_FALSE(inputs.update());
+  }
+  hostClockAdvance(5);
+  TEST_ASSERT_TRUE(inputs.update());
+  TEST_ASSERT_EQUAL_HEX32(0b100, inputs.getPressed());
+}
+
+void test_debounce_without_begin(void)
+{
+  // Inactive state and sampling from the first update
+  gbj_apphelpers::Debouncer<3> inputs(PINS);
+  hostPinSet(2, HIGH);
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    TEST_ASSERT_FALSE(inputs.update());
+    hostClockAdvance(5);
+  }
+  TEST_ASSERT_TRUE(inputs.update());
+  TEST_ASSERT_EQUAL_HEX32(0b001, inputs.getPressed());
+}
+
+void test_debounce_period(void)
+{
+  gbj_apphelpers::Debouncer<3> inputs(PINS, 0, 10);
+  inputs.begin();
+  hostPinSet(2, HIGH);
+  // Calls within the period do not sample
+  for (uint8_t i = 0; i < 20; i++)
+  {
+    hostClockAdvance(1);
+    inputs.update();
+  }
+  TEST_ASSERT_EQUAL_HEX32(0, inputs.getState());
+  hostClockAdvance(10);
+  TEST_ASSERT_FALSE(inputs.update());
+  hostClockAdvance(10);
+  TEST_ASSERT_TRUE(inputs.update());
+  TEST_ASSERT_EQUAL_HEX32(0b001, inputs.getState());
+}
+
+void test_debounce_active_low(void)
+{
+  hostPinSet(2, HIGH);
+  hostPinSet(3, HIGH);
+  gbj_apphelpers::Debouncer<3> inputs(PINS, 0b011);
+  inputs.begin();
+  TEST_ASSERT_EQUAL_HEX32(0, inputs.getState());
+  // Press of active low input
+  hostPinSet(3, LOW);
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    hostClockAdvance(5);
+    inputs.update();
+  }
+  TEST_ASSERT_EQUAL_HEX32(0b010, inputs.getState());
+  TEST_ASSERT_EQUAL_HEX32(0b010, inputs.getPressed());
+  hostPinSet(3, HIGH);
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    hostClockAdvance(5);
+    inputs.update();
+  }
+  TEST_ASSERT_EQUAL_HEX32(0b010, inputs.getReleased());
+}
+
+void test_debounce_tick(void)
+{
+  // Samples are provided directly, so that pins are not used
+  const uint8_t pins[32] = { 0 };
+  gbj_apphelpers::Debouncer<32> inputs(pins);
+  inputs.reset(0x0000FFFF);
+  // Each input toggles at its own time
+  uint32_t levels = 0xFFFF0000;
+  uint32_t pressed = 0, released = 0;
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    TEST_ASSERT_EQUAL(i == 3, inputs.tick(levels));
+    pressed |= inputs.getPressed();
+    released |= inputs.getReleased();
+  }
+  TEST_ASSERT_EQUAL_HEX32(0xFFFF0000, inputs.getState());
+  TEST_ASSERT_EQUAL_HEX32(0xFFFF0000, pressed);
+  TEST_ASSERT_EQUAL_HEX32(0x0000FFFF, released);
+  // Alternating inputs are never accepted
+  for (uint8_t i = 0; i < 16; i++)
+  {
+    TEST_ASSERT_FALSE(inputs.tick(levels ^ (i & 1 ? 0x55555555 : 0)));
+  }
+  TEST_ASSERT_EQUAL_HEX32(0xFFFF0000, inputs.getState());
+}
+
+void setup()
+{
+  UNITY_BEGIN();
+
+  RUN_TEST(test_debounce_steady);
+  RUN_TEST(test_debounce_bounce);
+  RUN_TEST(test_debounce_without_begin);
+  RUN_TEST(test_debounce_period);
+  RUN_TEST(test_debounce_active_low);
+  RUN_TEST(test_debounce_tick);
+
+  UNITY_END();
+}
+
+void loop() {}
@@ -3,7 +3,8 @@
   Unit tests of library "gbj_apphelpers" for formatting time periods in seconds.
 
   DESCRIPTION:
-  The test suite provides test cases related to various formatting styles.
+  The test suite provides test cases related to various formatting styles
+  into Strings as well as into character buffers.
   - The test runner is Unity Project - ThrowTheSwitch.org.
 
   LICENSE:
@@ -74,6 +75,157 @@ void test_period_dense_seconds(void)
                            gbj_apphelpers::formatTimePeriodDense(5).c_str());
 }
 
+void test_buffer_time(void)
+{
+  char buffer[gbj_apphelpers::FORMAT_TIMEDAY_LEN + 1];
+  TEST_ASSERT_EQUAL_UINT8(
+    8, gbj_apphelpers::formatTimeDay(buffer, sizeof(buffer), 29825));
+  TEST_ASSERT_EQUAL_STRING("08:17:05", buffer);
+}
+void test_buffer_period(void)
+{
+  char buffer[gbj_apphelpers::FORMAT_TIMEPERIOD_LEN + 1];
+  TEST_ASSERT_EQUAL_UINT8(
+    12, gbj_apphelpers::formatTimePeriod(buffer, sizeof(buffer), 289025));
+  TEST_ASSERT_EQUAL_STRING("3d 8h 17m 5s", buffer);
+  TEST_ASSERT_EQUAL_UINT8(
+    17, gbj_apphelpers::formatTimePeriod(buffer, sizeof(buffer), UINT32_MAX));
+  TEST_ASSERT_EQUAL_STRING("49710d 6h 28m 15s", buffer);
+}
+void test_buffer_period_dense(void)
+{
+  char buffer[gbj_apphelpers::FORMAT_TIMEPERIODDENSE_LEN + 1];
+  TEST_ASSERT_EQUAL_UINT8(
+    5, gbj_apphelpers::formatTimePeriodDense(buffer, sizeof(buffer), 1025));
+  TEST_ASSERT_EQUAL_STRING("17m5s", buffer);
+}
+void test_buffer_ms_period(void)
+{
+  char buffer[gbj_apphelpers::FORMAT_TIMEPERIOD_LEN + 1];
+  TEST_ASSERT_EQUAL_UINT8(
+    9, gbj_apphelpers::formatMsPeriod(buffer, sizeof(buffer), 29824600));
+  TEST_ASSERT_EQUAL_STRING("8h 17m 5s", buffer);
+}
+void test_buffer_small(void)
+{
+  char buffer[6] = "xxxxx";
+  TEST_ASSERT_EQUAL_UINT8(
+    0, gbj_apphelpers::formatTimePeriod(buffer, sizeof(buffer), 1025));
+  TEST_ASSERT_EQUAL_STRING("", buffer);
+  TEST_ASSERT_EQUAL_UINT8(
+    2, gbj_apphelpers::formatTimePeriod(buffer, sizeof(buffer), 5));
+  TEST_ASSERT_EQUAL_STRING("5s", buffer);
+  TEST_ASSERT_EQUAL_UINT8(
+    0, gbj_apphelpers::formatTimeDay(buffer, sizeof(buffer), 5));
+  TEST_ASSERT_EQUAL_STRING("", buffer);
+}
+
+void test_epoch(void)
+{
+  TEST_ASSERT_EQUAL_STRING(
+    "01.01.1970 00:00:00", gbj_apphelpers::formatEpochSeconds(0).c_str());
+  TEST_ASSERT_EQUAL_STRING(
+    "16.08.2021 12:34:56",
+    gbj_apphelpers::formatEpochSeconds(1629117296UL).c_str());
+  TEST_ASSERT_EQUAL_STRING(
+    "29.02.2024 23:59:59",
+    gbj_apphelpers::formatEpochSeconds(1709251199UL).c_str());
+}
+void test_buffer_epoch(void)
+{
+  char buffer[gbj_apphelpers::FORMAT_EPOCHSECONDS_LEN + 1];
+  TEST_ASSERT_EQUAL_UINT8(
+    19,
+    gbj_apphelpers::formatEpochSeconds(buffer, sizeof(buffer), 4294967295UL));
+  TEST_ASSERT_EQUAL_STRING("07.02.2106 06:28:15", buffer);
+}
+
+void test_epoch_formatter(void)
+{
+  gbj_apphelpers::EpochFormatter formatter;
+  TEST_ASSERT_EQUAL_STRING("16.08.2021 12:34:56",
+                           formatter.format(1629117296UL));
+  TEST_ASSERT_EQUAL_STRING("16.08.2021 12:34:57",
+                           formatter.format(1629117297UL));
+  TEST_ASSERT_EQUAL_STRING("16.08.2021 23:59:59",
+                           formatter.format(1629158399UL));
+  TEST_ASSERT_EQUAL_STRING("17.08.2021 00:00:00",
+                           formatter.format(1629158400UL));
+  // Backwards in time
+  TEST_ASSERT_EQUAL_STRING("01.01.1970 00:00:00", formatter.format(0));
+  TEST_ASSERT_EQUAL_STRING("07.02.2106 06:28:15",
+                           formatter.format(4294967295UL));
+}
+void test_epoch_formatter_consistency(void)
+{
+  gbj_apphelpers::EpochFormatter formatter;
+  char buffer[gbj_apphelpers::FORMAT_EPOCHSECONDS_LEN + 1];
+  for (unsigned long epoch = 1709200000UL; epoch < 1709300000UL; epoch += 7)
+  {
+    TEST_ASSERT_EQUAL_STRING(gbj_apphelpers::formatEpochSeconds(epoch).c_str(),
+                             formatter.format(epoch));
+  }
+  TEST_ASSERT_EQUAL_UINT8(
+    0, formatter.format(buffer, gbj_apphelpers::FORMAT_EPOCHSECONDS_LEN, 0));
+  TEST_ASSERT_EQUAL_STRING("", buffer);
+  TEST_ASSERT_EQUAL_UINT8(19, formatter.format(buffer, sizeof(buffer), 0));
+  TEST_ASSERT_EQUAL_STRING("01.01.1970 00:00:00", buffer);
+}
+void test_sprintf_equivalence(void)
+{
+  char expected[gbj_apphelpers::FORMAT_TIMEPERIOD_LEN + 1];
+  char buffer[gbj_apphelpers::FORMAT_TIMEPERIOD_LEN + 1];
+  // Digit counts of all segments including the widest values
+  const uint32_t periods[] = {
+    0,       9,        10,       59,       60,           3599,
+    3600,    86399,    86400,    863999,   864000,       8639999,
+    8640000, 86399999, 86400000, 99999999, 4294967295UL,
+  };
+  for (size_t i = 0; i < sizeof(periods) / sizeof(periods[0]); i++)
+  {
+    uint32_t total = periods[i];
+    unsigned long days = total / 86400;
+    unsigned hours = total / 3600 % 24;
+    unsigned minutes = total / 60 % 60;
+    unsigned seconds = total % 60;
+    if (days)
+    {
+      snprintf(expected,
+               sizeof(expected),
+               "%lud %uh %um %us",
+               days,
+               hours,
+               minutes,
+               seconds);
+    }
+    else if (hours)
+    {
+      snprintf(
+        expected, sizeof(expected), "%uh %um %us", hours, minutes, seconds);
+    }
+    else if (minutes)
+    {
+      snprintf(expected, sizeof(expected), "%um %us", minutes, seconds);
+    }
+    else
+    {
+      snprintf(expected, sizeof(expected), "%us", seconds);
+    }
+    TEST_ASSERT_EQUAL(
+      strlen(expected),
+      gbj_apphelpers::formatTimePeriod(buffer, sizeof(buffer), total));
+    TEST_ASSERT_EQUAL_STRING(expected, buffer);
+    snprintf(expected,
+             sizeof(expected),
+             "%02u:%02u:%02u",
+             hours,
+             minutes,
+             seconds);
+    gbj_apphelpers::formatTimeDay(buffer, sizeof(buffer), total);
+    TEST_ASSERT_EQUAL_STRING(expected, buffer);
+  }
+}
+
 void setup()
 {
   UNITY_BEGIN();
@@ -89,6 +241,16 @@ void setup()
   RUN_TEST(test_period_dense_hours);
   RUN_TEST(test_period_dense_minutes);
   RUN_TEST(test_period_dense_seconds);
+  RUN_TEST(test_buffer_time);
+  RUN_TEST(test_buffer_period);
+  RUN_TEST(test_buffer_period_dense);
+  RUN_TEST(test_buffer_ms_period);
+  RUN_TEST(test_buffer_small);
+  RUN_TEST(test_epoch);
+  RUN_TEST(test_buffer_epoch);
+  RUN_TEST(test_epoch_formatter);
+  RUN_TEST(test_epoch_formatter_consistency);
+  RUN_TEST(test_sprintf_equivalence);
 
   UNITY_END();
 }
@@ -23,6 +23,14 @@ gbj_apphelpers::Datetime dtRecord;
 char testDate[] = "Apr 21 2020";
 char testTime[] = "21:22:23";
 
+// Parsed at compile time
+constexpr gbj_apphelpers::Datetime dtConst =
+    gbj_apphelpers::parseDateTime("Apr 21 2020", "21:22:23");
+constexpr unsigned long epochConst =
+    gbj_apphelpers::parseEpoch("Apr 21 2020", "21:22:23");
+static_assert(dtConst.year == 2020, "compile time year");
+static_assert(epochConst == 1587504143UL, "compile time epoch");
+
 
 void setup_test()
 {
@@ -45,6 +53,162 @@ void test_ParseTime(void)
     TEST_ASSERT_EQUAL_INT(23, dtRecord.second);
 }
 
+void test_ParseConst(void)
+{
+    TEST_ASSERT_EQUAL_INT(2020, dtConst.year);
+    TEST_ASSERT_EQUAL_INT(4, dtConst.month);
+    TEST_ASSERT_EQUAL_INT(21, dtConst.day);
+    TEST_ASSERT_EQUAL_INT(21, dtConst.hour);
+    TEST_ASSERT_EQUAL_INT(22, dtConst.minute);
+    TEST_ASSERT_EQUAL_INT(23, dtConst.second);
+    // Tuesday
+    TEST_ASSERT_EQUAL_INT(2, dtConst.weekday);
+    TEST_ASSERT_FALSE(dtConst.mode12h);
+    TEST_ASSERT_TRUE(dtConst.pm);
+}
+
+void test_ParseConstEpoch(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(1587504143UL, epochConst);
+    TEST_ASSERT_EQUAL_UINT32(epochConst,
+                             gbj_apphelpers::convertDatetime2Epoch(dtConst));
+}
+
+void test_ParseConstSingleDigitDay(void)
+{
+    // Compiler pads single digit day with space
+    gbj_apphelpers::Datetime dt =
+        gbj_apphelpers::parseDateTime("Jan  1 2000", "00:00:00");
+    TEST_ASSERT_EQUAL_INT(2000, dt.year);
+    TEST_ASSERT_EQUAL_INT(1, dt.month);
+    TEST_ASSERT_EQUAL_INT(1, dt.day);
+    // Saturday
+    TEST_ASSERT_EQUAL_INT(6, dt.weekday);
+    TEST_ASSERT_FALSE(dt.pm);
+    TEST_ASSERT_EQUAL_UINT32(
+        946684800UL, gbj_apphelpers::parseEpoch("Jan  1 2000", "00:00:00"));
+}
+
+void test_ParseConstMonths(void)
+{
+    const char *months[] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                             "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+    char strDate[] = "Xxx 15 2024";
+    for (int i = 0; i < 12; i++)
+    {
+        memcpy(strDate, months[i], 3);
+        TEST_ASSERT_EQUAL_INT(
+            i + 1, gbj_apphelpers::parseDateTime(strDate, testTime).month);
+    }
+}
+
+void test_ParseIso8601(void)
+{
+    gbj_apphelpers::Datetime dt;
+    unsigned long epoch = 0;
+    TEST_ASSERT_EQUAL_INT(
+        gbj_apphelpers::PARSE_SUCCESS,
+        gbj_apphelpers::parseIso8601(dt, "2021-08-16T12:34:56Z", &epoch));
+    TEST_ASSERT_EQUAL_UINT32(1629117296UL, epoch);
+    TEST_ASSERT_EQUAL_INT(2021, dt.year);
+    TEST_ASSERT_EQUAL_INT(8, dt.month);
+    TEST_ASSERT_EQUAL_INT(16, dt.day);
+    TEST_ASSERT_EQUAL_INT(12, dt.hour);
+    TEST_ASSERT_EQUAL_INT(34, dt.minute);
+    TEST_ASSERT_EQUAL_INT(56, dt.second);
+    // Monday
+    TEST_ASSERT_EQUAL_INT(1, dt.weekday);
+    // Fraction and offsets
+    TEST_ASSERT_EQUAL_INT(
+        gbj_apphelpers::PARSE_SUCCESS,
+        gbj_apphelpers::parseIso8601(
+            dt, "2021-08-16T14:34:56.789+02:00", &epoch));
+    TEST_ASSERT_EQUAL_UINT32(1629117296UL, epoch);
+    TEST_ASSERT_EQUAL_INT(12, dt.hour);
+    TEST_ASSERT_EQUAL_INT(
+        gbj_apphelpers::PARSE_SUCCESS,
+        gbj_apphelpers::parseIso8601(dt, "2021-08-16 07:04:56-0530", &epoch));
+    TEST_ASSERT_EQUAL_UINT32(1629117296UL, epoch);
+    TEST_ASSERT_EQUAL_INT(
+        gbj_apphelpers::PARSE_SUCCESS,
+        gbj_apphelpers::parseIso8601(dt, "2021-08-16T13:34+01", &epoch));
+    TEST_ASSERT_EQUAL_UINT32(1629117240UL, epoch);
+    // Date only
+    TEST_ASSERT_EQUAL_INT(
+        gbj_apphelpers::PARSE_SUCCESS,
+        gbj_apphelpers::parseIso8601(dt, "2024-02-29", &epoch));
+    TEST_ASSERT_EQUAL_UINT32(1709164800UL, epoch);
+    // Offset moves datetime into epoch range
+    TEST_ASSERT_EQUAL_INT(
+        gbj_apphelpers::PARSE_SUCCESS,
+        gbj_apphelpers::parseIso8601(dt, "1969-12-31T23:00:00-01:00", &epoch));
+    TEST_ASSERT_EQUAL_UINT32(0, epoch);
+    TEST_ASSERT_EQUAL_INT(1970, dt.year);
+}
+
+void test_ParseIso8601Errors(void)
+{
+    gbj_apphelpers::Datetime dt;
+    const char *formatErrors[] = {
+        "", "2021", "2021-8-16", "2021-08-16T12", "2021-08-16T12:3",
+        "2021-08-16T12:34:56.", "2021-08-16T12:34:56X", "2021-08-16T12:34+1",
+        "2021/08/16", "2024-03-10T12:00:00+01:", "2024-03-10T12:00:00+01:0",
+    };
+    for (size_t i = 0; i < sizeof(formatErrors) / sizeof(formatErrors[0]); i++)
+    {
+        TEST_ASSERT_EQUAL_INT(gbj_apphelpers::PARSE_ERROR_FORMAT,
+                              gbj_apphelpers::parseIso8601(dt, formatErrors[i]));
+    }
+    const char *rangeErrors[] = {
+        "2021-13-01", "2021-00-01", "2021-02-29", "2021-04-31",
+        "2021-08-16T24:00:00", "2021-08-16T12:60", "2021-08-16T12:34:60",
+        "1969-12-31T23:59:59Z", "2106-02-07T06:28:16Z",
+        "2021-08-16T12:34+24:00",
+    };
+    for (size_t i = 0; i < sizeof(rangeErrors) / sizeof(rangeErrors[0]); i++)
+    {
+        TEST_ASSERT_EQUAL_INT(gbj_apphelpers::PARSE_ERROR_RANGE,
+                              gbj_apphelpers::parseIso8601(dt, rangeErrors[i]));
+    }
+    TEST_ASSERT_EQUAL_INT(
+        gbj_apphelpers::PARSE_SUCCESS,
+        gbj_apphelpers::parseIso8601(dt, "2106-02-07T06:28:15Z"));
+}
+
+void test_ParseRfc1123(void)
+{
+    gbj_apphelpers::Datetime dt;
+    unsigned long epoch = 0;
+    TEST_ASSERT_EQUAL_INT(
+        gbj_apphelpers::PARSE_SUCCESS,
+        gbj_apphelpers::parseRfc1123(
+            dt, "Sun, 06 Nov 1994 08:49:37 GMT", &epoch));
+    TEST_ASSERT_EQUAL_UINT32(784111777UL, epoch);
+    TEST_ASSERT_EQUAL_INT(1994, dt.year);
+    TEST_ASSERT_EQUAL_INT(11, dt.month);
+    TEST_ASSERT_EQUAL_INT(6, dt.day);
+    TEST_ASSERT_EQUAL_INT(8, dt.hour);
+    TEST_ASSERT_EQUAL_INT(49, dt.minute);
+    TEST_ASSERT_EQUAL_INT(37, dt.second);
+    // Sunday
+    TEST_ASSERT_EQUAL_INT(7, dt.weekday);
+    TEST_ASSERT_EQUAL_INT(
+        gbj_apphelpers::PARSE_ERROR_FORMAT,
+        gbj_apphelpers::parseRfc1123(dt, "Sun, 06 Nov 1994 08:49:37 UTC"));
+    TEST_ASSERT_EQUAL_INT(
+        gbj_apphelpers::PARSE_ERROR_FORMAT,
+        gbj_apphelpers::parseRfc1123(dt, "Sun 06 Nov 1994 08:49:37 GMT"));
+    TEST_ASSERT_EQUAL_INT(
+        gbj_apphelpers::PARSE_ERROR_FORMAT,
+        gbj_apphelpers::parseRfc1123(dt, "Xyz, 06 Nov 1994 08:49:37 GMT"));
+    TEST_ASSERT_EQUAL_INT(
+        gbj_apphelpers::PARSE_ERROR_FORMAT,
+        gbj_apphelpers::parseRfc1123(dt, "Sun, 06 Nox 1994 08:49:37 GMT"));
+    TEST_ASSERT_EQUAL_INT(
+        gbj_apphelpers::PARSE_ERROR_RANGE,
+        gbj_apphelpers::parseRfc1123(dt, "Sun, 31 Nov 1994 08:49:37 GMT"));
+}
+
 
 void setup() {
     setup_test();
@@ -52,6 +216,13 @@ void setup() {
 
     RUN_TEST(test_ParseDate);
     RUN_TEST(test_ParseTime);
+    RUN_TEST(test_ParseConst);
+    RUN_TEST(test_ParseConstEpoch);
+    RUN_TEST(test_ParseConstSingleDigitDay);
+    RUN_TEST(test_ParseConstMonths);
+    RUN_TEST(test_ParseIso8601);
+    RUN_TEST(test_ParseIso8601Errors);
+    RUN_TEST(test_ParseRfc1123);
 
     UNITY_END();
 }
@@ -0,0 +1,96 @@
+/*
+  NAME:
+  Unit tests of library "gbj_apphelpers" for barometric pressure and altitude.
+
+  DESCRIPTION:
+  The test suite provides test cases related to calculation of altitude from
+  barometric pressures and of sea level pressure from altitude in floating
+  point as well as fixed point arithmetic.
+  - The test runner is Unity Project - ThrowTheSwitch.org.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include <Arduino.h>
+#include <gbj_apphelpers.h>
+#include <unity.h>
+
+void test_altitude(void)
+{
+  TEST_ASSERT_FLOAT_WITHIN(
+    0.1, 1000.1, gbj_apphelpers::calculateAltitudeFromPressures(89875, 101325));
+  TEST_ASSERT_FLOAT_WITHIN(
+    0.1,
+    1000.1,
+    gbj_apphelpers::calculateAltitudeFromPressures(898.75, 1013.25));
+  TEST_ASSERT_FLOAT_WITHIN(
+    0.01, 0.0, gbj_apphelpers::calculateAltitudeFromPressures(101325, 101325));
+}
+
+void test_pressure_sea(void)
+{
+  TEST_ASSERT_FLOAT_WITHIN(
+    1.0, 95527.9, gbj_apphelpers::calculatePressureSeaFromAltitude(90000, 500));
+  TEST_ASSERT_FLOAT_WITHIN(
+    0.01, 900.0, gbj_apphelpers::calculatePressureSeaFromAltitude(900.0, 0));
+}
+
+void test_altitude_fixed(void)
+{
+  TEST_ASSERT_INT32_WITHIN(
+    3,
+    100011,
+    gbj_apphelpers::calculateAltitudeFromPressuresFixed(89875, 101325));
+  TEST_ASSERT_INT32_WITHIN(
+    1, 0, gbj_apphelpers::calculateAltitudeFromPressuresFixed(101325, 101325));
+  for (uint32_t pressure = 30500; pressure <= 111000; pressure += 97)
+  {
+    TEST_ASSERT_FLOAT_WITHIN(
+      0.03,
+      gbj_apphelpers::calculateAltitudeFromPressures(pressure, 101325),
+      gbj_apphelpers::calculateAltitudeFromPressuresFixed(pressure, 101325) /
+        100.0);
+  }
+  // Limited to the altitude for the lowest and highest ratio of pressures
+  TEST_ASSERT_EQUAL_INT32(
+    gbj_apphelpers::calculateAltitudeFromPressuresFixed(30000, 100000),
+    gbj_apphelpers::calculateAltitudeFromPressuresFixed(10000, 100000));
+  TEST_ASSERT_EQUAL_INT32(
+    gbj_apphelpers::calculateAltitudeFromPressuresFixed(110000, 100000),
+    gbj_apphelpers::calculateAltitudeFromPressuresFixed(100000, 0));
+}
+
+void test_pressure_sea_fixed(void)
+{
+  TEST_ASSERT_UINT32_WITHIN(
+    1,
+    95528,
+    gbj_apphelpers::calculatePressureSeaFromAltitudeFixed(90000, 50000));
+  TEST_ASSERT_EQUAL_UINT32(
+    90000, gbj_apphelpers::calculatePressureSeaFromAltitudeFixed(90000, 0));
+  for (int32_t altitude = -80000; altitude <= 880000; altitude += 997)
+  {
+    TEST_ASSERT_FLOAT_WITHIN(
+      1.0,
+      90000.0 / pow(1.0 - altitude / 4433000.0, 5.255),
+      gbj_apphelpers::calculatePressureSeaFromAltitudeFixed(90000, altitude));
+  }
+}
+
+void setup()
+{
+  UNITY_BEGIN();
+
+  RUN_TEST(test_altitude);
+  RUN_TEST(test_pressure_sea);
+  RUN_TEST(test_altitude_fixed);
+  RUN_TEST(test_pressure_sea_fixed);
+
+  UNITY_END();
+}
+
+void loop() {}
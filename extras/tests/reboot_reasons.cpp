@@ -0,0 +1,348 @@
+/*
+  NAME:
+  Unit tests of library "gbj_apphelpers" for reboot sources.
+
+  DESCRIPTION:
+  The test suite provides test cases related to textual names of built-in
+  reboot sources and of reboot sources registered by an application, and to
+  statistics of reboots.
+  - Persistent storage is simulated by a memory buffer, which counts writes
+    of each byte.
+  - The test runner is Unity Project - ThrowTheSwitch.org.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include <Arduino.h>
+#include <gbj_apphelpers.h>
+#include <unity.h>
+
+enum AppReboots : byte
+{
+  REBOOT_MQTT = gbj_apphelpers::MCUREBOOT_USER,
+  REBOOT_OTA,
+};
+GBJ_APPHELPERS_REBOOTS("MQTT", "Over the air update")
+
+using RebootStats = gbj_apphelpers::RebootStats<4, 20>;
+
+class MemoryStorage : public gbj_apphelpers::Storage
+{
+public:
+  uint8_t data[256];
+  uint16_t writes[256];
+  bool failing = false;
+
+  MemoryStorage()
+  {
+    // Erased EEPROM
+    memset(data, 0xFF, sizeof(data));
+    memset(writes, 0, sizeof(writes));
+  }
+  bool read(size_t address, uint8_t *buffer, size_t bufferLen) override
+  {
+    if (failing || address + bufferLen > sizeof(data))
+    {
+      return false;
+    }
+    memcpy(buffer, &data[address], bufferLen);
+    return true;
+  }
+  bool write(size_t address, const uint8_t *buffer, size_t bufferLen) override
+  {
+    if (failing || address + bufferLen > sizeof(data))
+    {
+      return false;
+    }
+    for (size_t i = 0; i < bufferLen; i++)
+    {
+      data[address + i] = buffer[i];
+      writes[address + i]++;
+    }
+    return true;
+  }
+};
+
+const char *rebootText(uint8_t code)
+{
+  return reinterpret_cast<const char *>(gbj_apphelpers::getRebootText(code));
+}
+
+void test_reboot_builtin(void)
+{
+  TEST_ASSERT_EQUAL_STRING("Unknown",
+                           rebootText(gbj_apphelpers::MCUREBOOT_UNKNOWN));
+  TEST_ASSERT_EQUAL_STRING("Permanent Error(s)",
+                           rebootText(gbj_apphelpers::MCUREBOOT_ERRORS));
+  TEST_ASSERT_EQUAL_STRING("Wifi", rebootText(gbj_apphelpers::MCUREBOOT_WIFI));
+  TEST_ASSERT_EQUAL_STRING("WebServer",
+                           rebootText(gbj_apphelpers::MCUREBOOT_WEB));
+  TEST_ASSERT_EQUAL_STRING("GoogleSpredsheets",
+                           rebootText(gbj_apphelpers::MCUREBOOT_GSHEET));
+  TEST_ASSERT_EQUAL_STRING("Thermometer",
+                           rebootText(gbj_apphelpers::MCUREBOOT_THERMO));
+  TEST_ASSERT_EQUAL_STRING("Thingspeak",
+                           rebootText(gbj_apphelpers::MCUREBOOT_THINGSPEAK));
+}
+
+void test_reboot_user(void)
+{
+  TEST_ASSERT_EQUAL_STRING("MQTT", rebootText(REBOOT_MQTT));
+  TEST_ASSERT_EQUAL_STRING("Over the air update", rebootText(REBOOT_OTA));
+}
+
+void test_reboot_unknown(void)
+{
+  TEST_ASSERT_EQUAL_STRING(
+    "Unknown", rebootText(gbj_apphelpers::MCUREBOOT_THINGSPEAK + 1));
+  TEST_ASSERT_EQUAL_STRING("Unknown",
+                           rebootText(gbj_apphelpers::MCUREBOOT_USER - 1));
+  TEST_ASSERT_EQUAL_STRING("Unknown", rebootText(REBOOT_OTA + 1));
+  TEST_ASSERT_EQUAL_STRING("Unknown", rebootText(255));
+}
+
+void test_reboot_string(void)
+{
+  String text = gbj_apphelpers::convertReboot2Text(
+    gbj_apphelpers::McuReboots::MCUREBOOT_WIFI);
+  TEST_ASSERT_EQUAL_STRING("Wifi", text.c_str());
+  text = gbj_apphelpers::convertReboot2Text(
+    static_cast<gbj_apphelpers::McuReboots>(REBOOT_MQTT));
+  TEST_ASSERT_EQUAL_STRING("MQTT", text.c_str());
+}
+
+void test_reboot_stats_history(void)
+{
+  RebootStats stats;
+  gbj_apphelpers::RebootRecord record;
+  TEST_ASSERT_EQUAL(0, stats.getCount());
+  TEST_ASSERT_FALSE(stats.getRecord(0, record));
+  for (uint8_t i = 0; i < 6; i++)
+  {
+    stats.add(gbj_apphelpers::MCUREBOOT_WIFI + i % 2, 1000 * i, 1600000000 + i);
+    TEST_ASSERT_EQUAL(i < 4 ? i + 1 : 4, stats.getCount());
+  }
+  // The newest record is the first one
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    TEST_ASSERT_TRUE(stats.getRecord(i, record));
+    TEST_ASSERT_EQUAL(gbj_apphelpers::MCUREBOOT_WIFI + (5 - i) % 2,
+                      record.reason);
+    TEST_ASSERT_EQUAL_UINT32(1000 * (5 - i), record.uptime);
+    TEST_ASSERT_EQUAL_UINT32(1600000000 + 5 - i, record.epoch);
+  }
+  TEST_ASSERT_FALSE(stats.getRecord(4, record));
+  // Counters cover all reboots
+  TEST_ASSERT_EQUAL(3, stats.getReasonCount(gbj_apphelpers::MCUREBOOT_WIFI));
+  TEST_ASSERT_EQUAL(3, stats.getReasonCount(gbj_apphelpers::MCUREBOOT_WEB));
+  TEST_ASSERT_EQUAL(0, stats.getReasonCount(gbj_apphelpers::MCUREBOOT_THERMO));
+}
+
+void test_reboot_stats_uptime(void)
+{
+  RebootStats stats;
+  gbj_apphelpers::RebootRecord record;
+  // Uptime over 97 days is kept in minutes, saturated after 15.9 years
+  const uint32_t uptimes[] = { 0, 8388607, 8388659, 8388660, UINT32_MAX };
+  const uint32_t expected[] = { 0, 8388607, 8388600, 8388660, 503316420 };
+  for (uint8_t i = 0; i < 5; i++)
+  {
+    stats.add(REBOOT_MQTT, uptimes[i]);
+    stats.getRecord(0, record);
+    TEST_ASSERT_EQUAL_UINT32(expected[i], record.uptime);
+    TEST_ASSERT_EQUAL(REBOOT_MQTT, record.reason);
+  }
+  // Reboot sources beyond counters are kept in history only
+  stats.add(100, 0);
+  TEST_ASSERT_EQUAL(5, stats.getReasonCount(REBOOT_MQTT));
+  TEST_ASSERT_EQUAL(0, stats.getReasonCount(100));
+  stats.getRecord(0, record);
+  TEST_ASSERT_EQUAL(100, record.reason);
+}
+
+void test_reboot_stats_serialize(void)
+{
+  RebootStats stats;
+  uint8_t buffer[RebootStats::SIZE];
+  TEST_ASSERT_EQUAL(0, stats.serialize(buffer, sizeof(buffer) - 1));
+  for (uint16_t i = 0; i < 300; i++)
+  {
+    stats.add(i % 3, i, i * 60);
+  }
+  TEST_ASSERT_EQUAL(RebootStats::SIZE, stats.serialize(buffer, sizeof(buffer)));
+  RebootStats restored;
+  TEST_ASSERT_TRUE(restored.deserialize(buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL(4, restored.getCount());
+  TEST_ASSERT_EQUAL(100, restored.getReasonCount(0));
+  gbj_apphelpers::RebootRecord record;
+  restored.getRecord(0, record);
+  TEST_ASSERT_EQUAL_UINT32(299, record.uptime);
+  restored.getRecord(3, record);
+  TEST_ASSERT_EQUAL_UINT32(296, record.uptime);
+  // Sequence continues after deserialization
+  restored.add(0, 300);
+  restored.getRecord(1, record);
+  TEST_ASSERT_EQUAL_UINT32(299, record.uptime);
+  TEST_ASSERT_EQUAL(4, restored.getCount());
+  // Different dimensions are rejected
+  gbj_apphelpers::RebootStats<5, 20> other;
+  TEST_ASSERT_FALSE(other.deserialize(buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL(0, other.getCount());
+}
+
+void test_reboot_stats_storage(void)
+{
+  MemoryStorage storage;
+  RebootStats stats;
+  // Erased storage is not valid statistics
+  TEST_ASSERT_FALSE(stats.load(storage, 16));
+  TEST_ASSERT_TRUE(stats.save(storage, 16));
+  for (uint8_t i = 0; i < 10; i++)
+  {
+    TEST_ASSERT_TRUE(stats.append(storage, REBOOT_OTA, i, 0, 16));
+  }
+  // Writes are spread over records
+  for (size_t i = 0; i < RebootStats::SIZE; i++)
+  {
+    TEST_ASSERT_LESS_OR_EQUAL(11, storage.writes[16 + i]);
+  }
+  TEST_ASSERT_EQUAL(3, storage.writes[16 + RebootStats::SIZE - 1]);
+  RebootStats loaded;
+  TEST_ASSERT_TRUE(loaded.load(storage, 16));
+  TEST_ASSERT_EQUAL(4, loaded.getCount());
+  TEST_ASSERT_EQUAL(10, loaded.getReasonCount(REBOOT_OTA));
+  gbj_apphelpers::RebootRecord record;
+  loaded.getRecord(0, record);
+  TEST_ASSERT_EQUAL_UINT32(9, record.uptime);
+  storage.failing = true;
+  TEST_ASSERT_FALSE(loaded.append(storage, REBOOT_OTA, 10, 0, 16));
+  TEST_ASSERT_FALSE(loaded.load(storage, 16));
+  TEST_ASSERT_EQUAL(0, loaded.getCount());
+}
+
+void test_reboot_stats_initialize(void)
+{
+  MemoryStorage storage;
+  RebootStats stats;
+  // Appending after failed loading writes entire statistics
+  TEST_ASSERT_FALSE(stats.load(storage));
+  TEST_ASSERT_TRUE(stats.append(storage, REBOOT_MQTT, 1));
+  TEST_ASSERT_EQUAL(1, storage.writes[0]);
+  TEST_ASSERT_EQUAL(1, storage.writes[RebootStats::SIZE - 1]);
+  // Next appending writes just the record and counter
+  TEST_ASSERT_TRUE(stats.append(storage, REBOOT_MQTT, 2));
+  TEST_ASSERT_EQUAL(1, storage.writes[0]);
+  RebootStats loaded;
+  TEST_ASSERT_TRUE(loaded.load(storage));
+  TEST_ASSERT_EQUAL(2, loaded.getCount());
+  TEST_ASSERT_EQUAL(2, loaded.getReasonCount(REBOOT_MQTT));
+  // Deserialized statistics is not known to be in storage
+  uint8_t buffer[RebootStats::SIZE];
+  loaded.serialize(buffer, sizeof(buffer));
+  MemoryStorage other;
+  TEST_ASSERT_TRUE(stats.deserialize(buffer, sizeof(buffer)));
+  TEST_ASSERT_TRUE(stats.append(other, REBOOT_MQTT, 3));
+  TEST_ASSERT_TRUE(loaded.load(other));
+  TEST_ASSERT_EQUAL(3, loaded.getCount());
+}
+
+void test_reboot_stats_wear(void)
+{
+  const uint8_t WIFI = gbj_apphelpers::MCUREBOOT_WIFI;
+  const uint8_t WEB = gbj_apphelpers::MCUREBOOT_WEB;
+  const uint16_t APPENDS = 400;
+  MemoryStorage storage;
+  RebootStats stats;
+  stats.save(storage);
+  // Repeating reboot source wears all records evenly and not its counter
+  for (uint16_t i = 0; i < APPENDS; i++)
+  {
+    TEST_ASSERT_TRUE(stats.append(storage, WIFI, i));
+  }
+  for (size_t i = 0; i < RebootStats::SIZE; i++)
+  {
+    TEST_ASSERT_LESS_OR_EQUAL(1 + APPENDS / 4, storage.writes[i]);
+  }
+  size_t counterWifi =
+    gbj_apphelpers::REBOOT_HEADER_SIZE +
+    WIFI * gbj_apphelpers::REBOOT_COUNTER_SIZE;
+  TEST_ASSERT_EQUAL(1, storage.writes[counterWifi]);
+  RebootStats loaded;
+  TEST_ASSERT_TRUE(loaded.load(storage));
+  TEST_ASSERT_EQUAL(APPENDS, loaded.getReasonCount(WIFI));
+  // Counter is written when the last record of its source is replaced
+  stats.append(storage, WEB, 0);
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    stats.append(storage, WIFI, i);
+  }
+  size_t counterWeb =
+    gbj_apphelpers::REBOOT_HEADER_SIZE +
+    WEB * gbj_apphelpers::REBOOT_COUNTER_SIZE;
+  TEST_ASSERT_EQUAL(2, storage.writes[counterWeb]);
+  TEST_ASSERT_TRUE(loaded.load(storage));
+  TEST_ASSERT_EQUAL(1, loaded.getReasonCount(WEB));
+  TEST_ASSERT_EQUAL(APPENDS + 4, loaded.getReasonCount(WIFI));
+  // Damaged counter is restored from records or ignored
+  storage.data[counterWifi] ^= 0x55;
+  storage.data[counterWeb] ^= 0x55;
+  TEST_ASSERT_TRUE(loaded.load(storage));
+  TEST_ASSERT_EQUAL(APPENDS + 4, loaded.getReasonCount(WIFI));
+  TEST_ASSERT_EQUAL(0, loaded.getReasonCount(WEB));
+}
+
+void test_reboot_stats_damaged(void)
+{
+  MemoryStorage storage;
+  RebootStats stats;
+  stats.save(storage);
+  for (uint8_t i = 0; i < 6; i++)
+  {
+    stats.append(storage, REBOOT_MQTT, i);
+  }
+  // Power loss at writing of the next record over the oldest one
+  size_t records = gbj_apphelpers::REBOOT_HEADER_SIZE +
+                   20 * gbj_apphelpers::REBOOT_COUNTER_SIZE;
+  size_t oldest = records + 2 * gbj_apphelpers::REBOOT_RECORD_SIZE;
+  storage.data[oldest] = 6;
+  storage.data[oldest + 2] = 6;
+  RebootStats loaded;
+  TEST_ASSERT_TRUE(loaded.load(storage));
+  TEST_ASSERT_EQUAL(3, loaded.getCount());
+  gbj_apphelpers::RebootRecord record;
+  loaded.getRecord(0, record);
+  TEST_ASSERT_EQUAL_UINT32(5, record.uptime);
+  loaded.getRecord(2, record);
+  TEST_ASSERT_EQUAL_UINT32(3, record.uptime);
+  // Next record replaces the damaged one
+  loaded.append(storage, REBOOT_MQTT, 6);
+  TEST_ASSERT_TRUE(loaded.load(storage));
+  TEST_ASSERT_EQUAL(4, loaded.getCount());
+  loaded.getRecord(0, record);
+  TEST_ASSERT_EQUAL_UINT32(6, record.uptime);
+}
+
+void setup()
+{
+  UNITY_BEGIN();
+
+  RUN_TEST(test_reboot_builtin);
+  RUN_TEST(test_reboot_user);
+  RUN_TEST(test_reboot_unknown);
+  RUN_TEST(test_reboot_string);
+  RUN_TEST(test_reboot_stats_history);
+  RUN_TEST(test_reboot_stats_uptime);
+  RUN_TEST(test_reboot_stats_serialize);
+  RUN_TEST(test_reboot_stats_storage);
+  RUN_TEST(test_reboot_stats_initialize);
+  RUN_TEST(test_reboot_stats_wear);
+  RUN_TEST(test_reboot_stats_damaged);
+
+  UNITY_END();
+}
+
+void loop() {}
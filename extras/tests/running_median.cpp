@@ -0,0 +1,119 @@
+/*
+  NAME:
+  Unit tests of library "gbj_apphelpers" for running median filter.
+
+  DESCRIPTION:
+  The test suite provides test cases for median of a sliding window of
+  various data types and window sizes.
+  - The test runner is Unity Project - ThrowTheSwitch.org.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include <Arduino.h>
+#include <unity.h>
+#include <gbj_apphelpers.h>
+
+// Compare running median with median of the window copy
+template<class T, uint16_t W>
+void verify_window(T (*sample)(uint16_t), uint16_t samples)
+{
+    gbj_apphelpers::RunningMedian<T, W> filter;
+    T history[W];
+    for (uint16_t i = 0; i < samples; i++)
+    {
+        T value = sample(i);
+        history[i % W] = value;
+        T result = filter.add(value);
+        uint16_t count = i < W ? i + 1 : W;
+        T window[W];
+        memcpy(window, history, count * sizeof(T));
+        TEST_ASSERT_EQUAL_UINT16(count, filter.getCount());
+        TEST_ASSERT_TRUE(result == gbj_apphelpers::median(window, count));
+    }
+}
+
+int sample_noise(uint16_t i)
+{
+    return (i * 7919L) % 211 - 100;
+}
+
+uint8_t sample_steps(uint16_t i)
+{
+    return (i / 7) % 4;
+}
+
+float sample_temperature(uint16_t i)
+{
+    return 21.5 + (i % 13) * 0.1 - (i % 29 == 0 ? 100.0 : 0.0);
+}
+
+void test_window_odd_int(void)
+{
+    verify_window<int, 15>(sample_noise, 200);
+}
+
+void test_window_even_int(void)
+{
+    verify_window<int, 8>(sample_noise, 200);
+}
+
+void test_window_equal_items(void)
+{
+    verify_window<uint8_t, 9>(sample_steps, 100);
+}
+
+void test_window_float(void)
+{
+    verify_window<float, 5>(sample_temperature, 100);
+}
+
+void test_window_single(void)
+{
+    verify_window<int, 1>(sample_noise, 20);
+}
+
+void test_median_lower(void)
+{
+    gbj_apphelpers::RunningMedian<int, 4> filter;
+    filter.add(10);
+    filter.add(40);
+    TEST_ASSERT_EQUAL_INT(25, filter.getMedian());
+    TEST_ASSERT_EQUAL_INT(10, filter.getMedianLower());
+    filter.add(20);
+    filter.add(30);
+    TEST_ASSERT_TRUE(filter.isFull());
+    TEST_ASSERT_EQUAL_INT(20, filter.getMedianLower());
+}
+
+void test_reset(void)
+{
+    gbj_apphelpers::RunningMedian<int, 3> filter;
+    filter.add(10);
+    filter.add(40);
+    filter.reset();
+    TEST_ASSERT_EQUAL_UINT16(0, filter.getCount());
+    TEST_ASSERT_EQUAL_INT(0, filter.getMedian());
+    TEST_ASSERT_EQUAL_INT(5, filter.add(5));
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_window_odd_int);
+    RUN_TEST(test_window_even_int);
+    RUN_TEST(test_window_equal_items);
+    RUN_TEST(test_window_float);
+    RUN_TEST(test_window_single);
+    RUN_TEST(test_median_lower);
+    RUN_TEST(test_reset);
+
+    UNITY_END();
+}
+
+void loop(){}
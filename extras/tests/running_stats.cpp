@@ -0,0 +1,162 @@
+/*
+  NAME:
+  Unit tests of library "gbj_apphelpers" for running statistics.
+
+  DESCRIPTION:
+  The test suite provides test cases for mean, variance, minimum, and maximum
+  of a sliding window of various data types and window sizes compared with
+  statistics calculated from a copy of the window.
+  - The test runner is Unity Project - ThrowTheSwitch.org.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include <Arduino.h>
+#include <gbj_apphelpers.h>
+#include <unity.h>
+
+// Compare running statistics with statistics of the window copy
+template<class T, uint16_t W>
+void verify_window(T (*sample)(uint16_t), uint16_t samples, double delta)
+{
+  gbj_apphelpers::RunningStats<T, W> stats;
+  T history[W];
+  for (uint16_t i = 0; i < samples; i++)
+  {
+    T value = sample(i);
+    history[i % W] = value;
+    stats.add(value);
+    uint16_t count = i < W ? i + 1 : W;
+    TEST_ASSERT_EQUAL_UINT16(count, stats.getCount());
+    T valMin = history[0], valMax = history[0];
+    double sum = 0;
+    for (uint16_t j = 0; j < count; j++)
+    {
+      valMin = history[j] < valMin ? history[j] : valMin;
+      valMax = valMax < history[j] ? history[j] : valMax;
+      sum += history[j];
+    }
+    double mean = sum / count;
+    double m2 = 0;
+    for (uint16_t j = 0; j < count; j++)
+    {
+      m2 += (history[j] - mean) * (history[j] - mean);
+    }
+    TEST_ASSERT_TRUE(valMin == stats.getMin());
+    TEST_ASSERT_TRUE(valMax == stats.getMax());
+    TEST_ASSERT_FLOAT_WITHIN(delta, mean, stats.getMean());
+    TEST_ASSERT_FLOAT_WITHIN(
+      delta, count > 1 ? m2 / (count - 1) : 0.0, stats.getVariance());
+  }
+}
+
+int sample_noise(uint16_t i)
+{
+  return (i * 7919L) % 211 - 100;
+}
+
+uint8_t sample_steps(uint16_t i)
+{
+  return (i / 7) % 4;
+}
+
+float sample_temperature(uint16_t i)
+{
+  return 21.5 + (i % 13) * 0.1 - (i % 29 == 0 ? 100.0 : 0.0);
+}
+
+// Large offset with small variation for numerical stability
+long sample_pressure(uint16_t i)
+{
+  return 100000000L + (i * 31L) % 17;
+}
+
+void test_stats_empty(void)
+{
+  gbj_apphelpers::RunningStats<int, 5> stats;
+  TEST_ASSERT_EQUAL(0, stats.getCount());
+  TEST_ASSERT_EQUAL(0, stats.getMin());
+  TEST_ASSERT_EQUAL(0, stats.getMax());
+  TEST_ASSERT_EQUAL_FLOAT(0.0, stats.getMean());
+  TEST_ASSERT_EQUAL_FLOAT(0.0, stats.getVariance());
+  stats.add(-7);
+  TEST_ASSERT_EQUAL(-7, stats.getMin());
+  TEST_ASSERT_EQUAL(-7, stats.getMax());
+  TEST_ASSERT_EQUAL_FLOAT(-7.0, stats.getMean());
+  TEST_ASSERT_EQUAL_FLOAT(0.0, stats.getVariance());
+  stats.add(-3);
+  TEST_ASSERT_EQUAL_FLOAT(2.8284271, stats.getDeviation());
+  stats.reset();
+  TEST_ASSERT_EQUAL(0, stats.getCount());
+  TEST_ASSERT_FALSE(stats.isFull());
+}
+
+void test_stats_int(void)
+{
+  verify_window<int, 1>(sample_noise, 20, 1e-9);
+  verify_window<int, 15>(sample_noise, 300, 1e-9);
+  verify_window<int, 16>(sample_noise, 300, 1e-9);
+}
+
+void test_stats_steps(void)
+{
+  // Many equal samples in deques
+  verify_window<uint8_t, 10>(sample_steps, 200, 1e-9);
+}
+
+void test_stats_float(void)
+{
+  verify_window<float, 9>(sample_temperature, 300, 1e-4);
+}
+
+void test_stats_stability(void)
+{
+  verify_window<long, 12>(sample_pressure, 5000, 1e-9);
+}
+
+// Comparable data type without arithmetic
+struct Version
+{
+  uint8_t major;
+  uint8_t minor;
+  bool operator<(const Version &other) const
+  {
+    return major < other.major || (major == other.major && minor < other.minor);
+  }
+};
+
+void test_stats_custom(void)
+{
+  gbj_apphelpers::RunningStats<Version, 3, void> stats;
+  const Version versions[] = { { 1, 2 }, { 1, 10 }, { 0, 9 }, { 2, 0 },
+                               { 1, 1 }, { 1, 5 } };
+  const uint8_t minimums[] = { 2, 2, 9, 9, 9, 1 };
+  const uint8_t maximums[] = { 2, 10, 10, 0, 0, 0 };
+  for (uint8_t i = 0; i < 6; i++)
+  {
+    stats.add(versions[i]);
+    TEST_ASSERT_EQUAL(minimums[i], stats.getMin().minor);
+    TEST_ASSERT_EQUAL(maximums[i], stats.getMax().minor);
+  }
+  TEST_ASSERT_TRUE(stats.isFull());
+}
+
+void setup()
+{
+  UNITY_BEGIN();
+
+  RUN_TEST(test_stats_empty);
+  RUN_TEST(test_stats_int);
+  RUN_TEST(test_stats_steps);
+  RUN_TEST(test_stats_float);
+  RUN_TEST(test_stats_stability);
+  RUN_TEST(test_stats_custom);
+
+  UNITY_END();
+}
+
+void loop() {}
@@ -4,7 +4,7 @@
 
   DESCRIPTION:
   The test suite provides test cases related to sanitizing numbers of various
-  data types for valid range.
+  data types for valid range, both single values and data buffers.
   - The test runner is Unity Project - ThrowTheSwitch.org.
 
   LICENSE:
@@ -81,6 +81,47 @@ void test_float(void)
     "Within RANGE");
 }
 
+void test_check_array_int(void)
+{
+  int buffer[] = { -101, -100, 0, 200, 201, 50, 1000, -5000, 7, 8, 9 };
+  uint8_t mask[2];
+  TEST_ASSERT_EQUAL_INT(4, gbj_apphelpers::checkArray(buffer, 11, -100, 200));
+  TEST_ASSERT_EQUAL_INT(
+    4, gbj_apphelpers::checkArray(buffer, 11, -100, 200, mask));
+  TEST_ASSERT_EQUAL_HEX8(0xD1, mask[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, mask[1]);
+  TEST_ASSERT_EQUAL_INT(-101, buffer[0]);
+}
+
+void test_sanitize_array_float(void)
+{
+  float buffer[20];
+  float buffer_e[20];
+  uint8_t mask[3];
+  for (byte i = 0; i < 20; i++)
+  {
+    buffer[i] = i % 3 ? 21.5 + i : -127.0;
+    buffer_e[i] = i % 3 ? 21.5 + i : 20.0;
+  }
+  buffer[19] = 85.0;
+  buffer_e[19] = 20.0;
+  TEST_ASSERT_EQUAL_INT(
+    8, gbj_apphelpers::sanitizeArray(buffer, 20, 20.0f, -55.0f, 80.0f, mask));
+  TEST_ASSERT_EQUAL_FLOAT_ARRAY(buffer_e, buffer, 20);
+  TEST_ASSERT_EQUAL_HEX8(0x49, mask[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x92, mask[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x0C, mask[2]);
+}
+
+void test_sanitize_array_reduced(void)
+{
+  uint8_t buffer[] = { 5, 25, 15, 30, 30 };
+  uint8_t buffer_e[] = { 15, 15, 15, 30, 30 };
+  TEST_ASSERT_EQUAL_INT(
+    2, gbj_apphelpers::sanitizeArray<uint8_t>(buffer, 3, 15, 10, 20));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(buffer_e, buffer, 5);
+}
+
 void setup()
 {
   UNITY_BEGIN();
@@ -88,6 +129,9 @@ void setup()
   RUN_TEST(test_byte);
   RUN_TEST(test_int);
   RUN_TEST(test_float);
+  RUN_TEST(test_check_array_int);
+  RUN_TEST(test_sanitize_array_float);
+  RUN_TEST(test_sanitize_array_reduced);
 
   UNITY_END();
 }
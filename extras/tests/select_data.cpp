@@ -0,0 +1,102 @@
+/*
+  NAME:
+  Unit tests of library "gbj_apphelpers" for templated selection functions.
+
+  DESCRIPTION:
+  The test suite provides test cases for selecting n-th item, median, and
+  percentile of various data types in data buffers.
+  - The test runner is Unity Project - ThrowTheSwitch.org.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include <Arduino.h>
+#include <unity.h>
+#include <gbj_apphelpers.h>
+
+void test_select_nth_int(void)
+{
+    const uint16_t dataLen = 301;
+    for (uint16_t nth = 0; nth < dataLen; nth += 25)
+    {
+        int buffer[dataLen];
+        for (uint16_t i = 0; i < dataLen; i++)
+        {
+            buffer[i] = (i * 7919L) % dataLen;
+        }
+        TEST_ASSERT_EQUAL_INT(nth, gbj_apphelpers::select_nth(buffer, dataLen, nth));
+        for (uint16_t i = 0; i < dataLen; i++)
+        {
+            TEST_ASSERT_TRUE(i < nth ? buffer[i] <= (int)nth : buffer[i] >= (int)nth);
+        }
+    }
+}
+
+void test_select_nth_desc(void)
+{
+    float buffer[] = {25.12, 20.34, 15.56, 10.78, -0.82, -5.91};
+    TEST_ASSERT_EQUAL_FLOAT(20.34, gbj_apphelpers::select_nth(buffer, 6, 1, gbj_apphelpers::CompareDesc<float>()));
+}
+
+void test_select_nth_beyond(void)
+{
+    uint8_t buffer[] = {5, 9, 1, 7};
+    TEST_ASSERT_EQUAL_UINT8(9, gbj_apphelpers::select_nth(buffer, 4, 10));
+}
+
+void test_median_odd(void)
+{
+    float buffer[] = {21.5, 21.7, 85.0, 21.6, -127.0};
+    TEST_ASSERT_EQUAL_FLOAT(21.6, gbj_apphelpers::median(buffer, 5));
+}
+
+void test_median_even(void)
+{
+    int buffer[] = {40, 10, 30, 20};
+    TEST_ASSERT_EQUAL_INT(25, gbj_apphelpers::median(buffer, 4));
+}
+
+void test_median_reduced(void)
+{
+    uint16_t buffer[] = {7, 3, 5, 1000, 1000, 1000};
+    TEST_ASSERT_EQUAL_UINT16(5, gbj_apphelpers::median(buffer, 3));
+    TEST_ASSERT_EQUAL_UINT16(1000, buffer[3]);
+}
+
+void test_median_empty(void)
+{
+    int buffer[] = {1};
+    TEST_ASSERT_EQUAL_INT(0, gbj_apphelpers::median(buffer, 0));
+}
+
+void test_percentile(void)
+{
+    int buffer[] = {15, 20, 35, 40, 50};
+    TEST_ASSERT_EQUAL_INT(15, gbj_apphelpers::percentile(buffer, 5, 0));
+    TEST_ASSERT_EQUAL_INT(20, gbj_apphelpers::percentile(buffer, 5, 30));
+    TEST_ASSERT_EQUAL_INT(20, gbj_apphelpers::percentile(buffer, 5, 40));
+    TEST_ASSERT_EQUAL_INT(35, gbj_apphelpers::percentile(buffer, 5, 50));
+    TEST_ASSERT_EQUAL_INT(50, gbj_apphelpers::percentile(buffer, 5, 100));
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_select_nth_int);
+    RUN_TEST(test_select_nth_desc);
+    RUN_TEST(test_select_nth_beyond);
+    RUN_TEST(test_median_odd);
+    RUN_TEST(test_median_even);
+    RUN_TEST(test_median_reduced);
+    RUN_TEST(test_median_empty);
+    RUN_TEST(test_percentile);
+
+    UNITY_END();
+}
+
+void loop(){}
@@ -0,0 +1,127 @@
+/*
+  NAME:
+  Unit tests of library "gbj_apphelpers" for smoothing filters.
+
+  DESCRIPTION:
+  The test suite provides test cases for exponential moving average and
+  second order IIR filter in integer and floating point arithmetic.
+  - Integer filters are compared with float ones.
+  - The test runner is Unity Project - ThrowTheSwitch.org.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include <Arduino.h>
+#include <gbj_apphelpers.h>
+#include <unity.h>
+
+int16_t sample_noise(uint16_t i)
+{
+  return 500 + (i * 7919L) % 211 - 100 + (i > 100 ? 300 : 0);
+}
+
+void test_ema_initial(void)
+{
+  gbj_apphelpers::FilterEma<int16_t, 3> filter;
+  TEST_ASSERT_EQUAL_INT16(0, filter.getValue());
+  TEST_ASSERT_EQUAL_INT16(-250, filter.add(-250));
+  filter.reset(100);
+  TEST_ASSERT_EQUAL_INT16(100, filter.getValue());
+  // (100 * 7 + 108) / 8
+  TEST_ASSERT_EQUAL_INT16(101, filter.add(108));
+  filter.reset();
+  TEST_ASSERT_EQUAL_INT16(77, filter.add(77));
+}
+
+void test_ema_steady(void)
+{
+  // No dead band, the output reaches the input exactly
+  gbj_apphelpers::FilterEma<int16_t, 4> filter;
+  filter.add(0);
+  for (uint16_t i = 0; i < 500; i++)
+  {
+    filter.add(3);
+  }
+  TEST_ASSERT_EQUAL_INT16(3, filter.getValue());
+  for (uint16_t i = 0; i < 500; i++)
+  {
+    filter.add(-1000);
+  }
+  TEST_ASSERT_EQUAL_INT16(-1000, filter.getValue());
+  gbj_apphelpers::FilterEma<uint16_t, 15> slow;
+  slow.add(65535);
+  TEST_ASSERT_EQUAL_UINT16(65535, slow.add(65535));
+}
+
+void test_ema_float(void)
+{
+  gbj_apphelpers::FilterEma<int16_t, 3> filter;
+  gbj_apphelpers::FilterEma<float, 3> reference;
+  for (uint16_t i = 0; i < 300; i++)
+  {
+    int16_t value = sample_noise(i);
+    TEST_ASSERT_FLOAT_WITHIN(
+      1.0, reference.add(value), static_cast<float>(filter.add(value)));
+  }
+  reference.reset(0.0);
+  TEST_ASSERT_EQUAL_FLOAT(0.125, reference.add(1.0));
+}
+
+void test_iir2_step(void)
+{
+  gbj_apphelpers::FilterIir2<int16_t, 2> filter;
+  gbj_apphelpers::FilterIir2<float, 2> reference;
+  filter.add(0);
+  reference.add(0);
+  int16_t last = 0;
+  for (uint16_t i = 0; i < 100; i++)
+  {
+    int16_t value = filter.add(1000);
+    TEST_ASSERT_INT_WITHIN(1, reference.add(1000), value);
+    // No overshooting
+    TEST_ASSERT_TRUE(value >= last && value <= 1000);
+    last = value;
+  }
+  TEST_ASSERT_EQUAL_INT16(1000, filter.getValue());
+  // Steady inputs are reached exactly for any shifts
+  gbj_apphelpers::FilterIir2<int16_t, 4, 3> slow;
+  slow.add(-32768);
+  for (uint16_t i = 0; i < 1000; i++)
+  {
+    slow.add(i < 500 ? 32767 : -3);
+  }
+  TEST_ASSERT_EQUAL_INT16(-3, slow.getValue());
+}
+
+void test_iir2_noise(void)
+{
+  gbj_apphelpers::FilterIir2<int16_t, 3, 2> filter;
+  gbj_apphelpers::FilterIir2<float, 3, 2> reference;
+  for (uint16_t i = 0; i < 300; i++)
+  {
+    int16_t value = sample_noise(i);
+    TEST_ASSERT_FLOAT_WITHIN(
+      1.0, reference.add(value), static_cast<float>(filter.add(value)));
+  }
+  filter.reset(-7);
+  TEST_ASSERT_EQUAL_INT16(-7, filter.add(-7));
+}
+
+void setup()
+{
+  UNITY_BEGIN();
+
+  RUN_TEST(test_ema_initial);
+  RUN_TEST(test_ema_steady);
+  RUN_TEST(test_ema_float);
+  RUN_TEST(test_iir2_step);
+  RUN_TEST(test_iir2_noise);
+
+  UNITY_END();
+}
+
+void loop() {}
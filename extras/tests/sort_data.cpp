@@ -4,7 +4,7 @@
 
   DESCRIPTION:
   The test suite provides test cases for various data types of sorted data
-  buffers.
+  buffers and for introspective, stable, and buble sorting.
   - The test runner is Unity Project - ThrowTheSwitch.org.
 
   LICENSE:
@@ -72,6 +72,114 @@ void test_sort_buble_desc_int_reduced(void)
     TEST_ASSERT_EQUAL_INT16_ARRAY(buffer_e, buffer, dataLen);
 }
 
+struct Keyed
+{
+    int key;
+    int order;
+    bool operator<(const Keyed &other) const { return key < other.key; }
+};
+
+void test_sort_buble_stable(void)
+{
+    // Legacy sorting keeps original order of equal items
+    const byte dataLen = 60;
+    Keyed buffer[dataLen];
+    for (byte i = 0; i < dataLen; i++)
+    {
+        buffer[i].key = (i * 7) % 5;
+        buffer[i].order = i;
+    }
+    gbj_apphelpers::sort_buble_asc(buffer, dataLen);
+    for (byte i = 1; i < dataLen; i++)
+    {
+        TEST_ASSERT_TRUE(buffer[i - 1].key < buffer[i].key ||
+                         (buffer[i - 1].key == buffer[i].key &&
+                          buffer[i - 1].order < buffer[i].order));
+    }
+    gbj_apphelpers::sort_buble_desc(buffer, dataLen);
+    for (byte i = 1; i < dataLen; i++)
+    {
+        TEST_ASSERT_TRUE(buffer[i].key < buffer[i - 1].key ||
+                         (buffer[i - 1].key == buffer[i].key &&
+                          buffer[i - 1].order < buffer[i].order));
+    }
+}
+
+void test_sort_asc_random(void)
+{
+    const uint16_t dataLen = 500;
+    int32_t buffer[dataLen];
+    for (uint16_t i = 0; i < dataLen; i++)
+    {
+        buffer[i] = (i * 7919L) % 1009 - 500;
+    }
+    gbj_apphelpers::sort_asc(buffer, dataLen);
+    for (uint16_t i = 1; i < dataLen; i++)
+    {
+        TEST_ASSERT_TRUE(buffer[i - 1] <= buffer[i]);
+    }
+}
+
+void test_sort_desc_equal_items(void)
+{
+    uint8_t buffer[40];
+    for (byte i = 0; i < 40; i++)
+    {
+        buffer[i] = i % 3;
+    }
+    gbj_apphelpers::sort_desc(buffer, 40);
+    for (byte i = 0; i < 40; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT8(i < 13 ? 2 : (i < 26 ? 1 : 0), buffer[i]);
+    }
+}
+
+bool compareAbs(const int &item1, const int &item2)
+{
+    return abs(item1) < abs(item2);
+}
+
+void test_sort_comparator(void)
+{
+    int buffer[] = {-5, 4, -3, 2, -1, 0};
+    int buffer_e[] = {0, -1, 2, -3, 4, -5};
+    byte dataLen = sizeof(buffer) / sizeof(buffer[0]);
+    gbj_apphelpers::sort(buffer, dataLen, compareAbs);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(buffer_e, buffer, dataLen);
+}
+
+void test_sort_stable_comparator(void)
+{
+    // Sort by tens, units keep original order
+    const byte dataLen = 60;
+    int buffer[dataLen];
+    for (byte i = 0; i < dataLen; i++)
+    {
+        buffer[i] = (5 - i % 6) * 10 + i / 6;
+    }
+    struct CompareTens
+    {
+        bool operator()(const int &item1, const int &item2) const
+        {
+            return item1 / 10 < item2 / 10;
+        }
+    };
+    gbj_apphelpers::sort_stable(buffer, dataLen, CompareTens());
+    for (byte i = 0; i < dataLen; i++)
+    {
+        TEST_ASSERT_EQUAL_INT((i / 10) * 10 + i % 10, buffer[i]);
+    }
+}
+
+void test_sort_stable_desc_reduced(void)
+{
+    float buffer[] = {-5.91, 25.12, 10.78, 20.34, 15.56, -0.82};
+    float buffer_e[] = {25.12, 20.34, 10.78, -5.91, 15.56, -0.82};
+    byte dataLen = sizeof(buffer) / sizeof(buffer[0]);
+    gbj_apphelpers::sort_stable_desc(buffer, 4);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(buffer_e, buffer, dataLen);
+}
+
 
 void setup() {
     UNITY_BEGIN();
@@ -82,6 +190,12 @@ void setup() {
     RUN_TEST(test_sort_buble_asc_float);
     RUN_TEST(test_sort_buble_desc_int);
     RUN_TEST(test_sort_buble_desc_int_reduced);
+    RUN_TEST(test_sort_buble_stable);
+    RUN_TEST(test_sort_asc_random);
+    RUN_TEST(test_sort_desc_equal_items);
+    RUN_TEST(test_sort_comparator);
+    RUN_TEST(test_sort_stable_comparator);
+    RUN_TEST(test_sort_stable_desc_reduced);
 
     UNITY_END();
 }
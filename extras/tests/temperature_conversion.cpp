@@ -36,6 +36,149 @@ void test_Dewpoint(void)
     TEST_ASSERT_FLOAT_WITHIN(0.001, 16.43, gbj_apphelpers::calculateDewpoint(78.40, 20.30));
 }
 
+void test_Celsius2FahrenheitArray(void)
+{
+    float temp[] = {20.0, 25.3, -40.0, 0.0, 100.0};
+    float result[5];
+    gbj_apphelpers::convertCelsius2FahrenheitArray(temp, result, 5);
+    for (size_t i = 0; i < 5; i++)
+    {
+        TEST_ASSERT_EQUAL_FLOAT(gbj_apphelpers::convertCelsius2Fahrenheit(temp[i]), result[i]);
+    }
+    // In place
+    gbj_apphelpers::convertCelsius2FahrenheitArray(temp, temp, 5);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(result, temp, 5);
+}
+
+void test_Fahrenheit2CelsiusArray(void)
+{
+    float temp[] = {68.0, 77.54, -40.0, 32.0, 212.0};
+    float result[5];
+    gbj_apphelpers::convertFahrenheit2CelsiusArray(temp, result, 5);
+    for (size_t i = 0; i < 5; i++)
+    {
+        TEST_ASSERT_EQUAL_FLOAT(gbj_apphelpers::convertFahrenheit2Celsius(temp[i]), result[i]);
+    }
+}
+
+void test_DewpointArray(void)
+{
+    const size_t LEN = 400;
+    float rhum[LEN], temp[LEN], dewpoint[LEN];
+    // Whole range of humidity and temperatures, not aligned to vector width
+    for (size_t i = 0; i < LEN; i++)
+    {
+        rhum[i] = 0.25 + (i % 100);
+        temp[i] = -40.0 + 0.23 * i;
+    }
+    TEST_ASSERT_EQUAL(0, gbj_apphelpers::calculateDewpointArray(rhum, temp, dewpoint, LEN - 3));
+    for (size_t i = 0; i < LEN - 3; i++)
+    {
+        TEST_ASSERT_FLOAT_WITHIN(0.001, gbj_apphelpers::calculateDewpoint(rhum[i], temp[i]), dewpoint[i]);
+    }
+    // Invalid humidity and temperature, in place calculation
+    rhum[1] = 0.0;
+    rhum[2] = -5.0;
+    temp[3] = -300.0;
+    TEST_ASSERT_EQUAL(3, gbj_apphelpers::calculateDewpointArray(rhum, temp, temp, 5));
+    TEST_ASSERT_FLOAT_WITHIN(0.001, gbj_apphelpers::calculateDewpoint(0.25, -40.0), temp[0]);
+    TEST_ASSERT_EQUAL_FLOAT(-999.0, temp[1]);
+    TEST_ASSERT_EQUAL_FLOAT(-999.0, temp[2]);
+    TEST_ASSERT_EQUAL_FLOAT(-999.0, temp[3]);
+    rhum[0] = 55.0;
+    temp[0] = 25.0;
+    TEST_ASSERT_EQUAL(0, gbj_apphelpers::calculateDewpointArray(rhum, temp, dewpoint, 1));
+    TEST_ASSERT_FLOAT_WITHIN(0.001, 15.36, dewpoint[0]);
+    // Negative zero and fractions have bits overflowing signed arithmetic
+    rhum[1] = -0.0f;
+    rhum[2] = -0.5f;
+    temp[1] = temp[2] = 25.0;
+    TEST_ASSERT_EQUAL(2, gbj_apphelpers::calculateDewpointArray(rhum, temp, dewpoint, 3));
+    TEST_ASSERT_FLOAT_WITHIN(0.001, 15.36, dewpoint[0]);
+    TEST_ASSERT_EQUAL_FLOAT(-999.0, dewpoint[1]);
+    TEST_ASSERT_EQUAL_FLOAT(-999.0, dewpoint[2]);
+}
+void test_TemperatureFixed(void)
+{
+    TEST_ASSERT_EQUAL_INT32(6800, gbj_apphelpers::convertCelsius2FahrenheitFixed(2000));
+    TEST_ASSERT_EQUAL_INT32(7754, gbj_apphelpers::convertCelsius2FahrenheitFixed(2530));
+    TEST_ASSERT_EQUAL_INT32(-4000, gbj_apphelpers::convertCelsius2FahrenheitFixed(-4000));
+    TEST_ASSERT_EQUAL_INT32(2000, gbj_apphelpers::convertFahrenheit2CelsiusFixed(6800));
+    TEST_ASSERT_EQUAL_INT32(2530, gbj_apphelpers::convertFahrenheit2CelsiusFixed(7754));
+    TEST_ASSERT_EQUAL_INT32(-4000, gbj_apphelpers::convertFahrenheit2CelsiusFixed(-4000));
+    // Rounding of negative values to the nearest centi-degree
+    TEST_ASSERT_EQUAL_INT32(-1778, gbj_apphelpers::convertFahrenheit2CelsiusFixed(0));
+    TEST_ASSERT_EQUAL_INT32(3198, gbj_apphelpers::convertCelsius2FahrenheitFixed(-1));
+}
+
+void test_DewpointFixed(void)
+{
+    TEST_ASSERT_INT32_WITHIN(2, 1536, gbj_apphelpers::calculateDewpointFixed(550, 2500));
+    TEST_ASSERT_INT32_WITHIN(2, 1643, gbj_apphelpers::calculateDewpointFixed(784, 2030));
+    for (int32_t temp = -4000; temp <= 6000; temp += 370)
+    {
+        for (uint16_t rhum = 5; rhum <= 1000; rhum += 35)
+        {
+            TEST_ASSERT_FLOAT_WITHIN(0.02, gbj_apphelpers::calculateDewpoint(rhum / 10.0, temp / 100.0),
+                                     gbj_apphelpers::calculateDewpointFixed(rhum, temp) / 100.0);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT32(-99900, gbj_apphelpers::calculateDewpointFixed(0, 2500));
+    TEST_ASSERT_EQUAL_INT32(-99900, gbj_apphelpers::calculateDewpointFixed(550, -30000));
+    // The lowest temperature without overflow of 32-bit long divisions
+    for (int32_t temp = -23565; temp < -22869; temp += 29)
+    {
+        TEST_ASSERT_EQUAL_INT32(-99900, gbj_apphelpers::calculateDewpointFixed(1000, temp));
+    }
+    TEST_ASSERT_EQUAL_INT32(-99900, gbj_apphelpers::calculateDewpointFixed(1000, -22870));
+    const uint16_t rhums[] = {1, 10, 100, 1000, 65535};
+    for (uint8_t i = 0; i < sizeof(rhums) / sizeof(rhums[0]); i++)
+    {
+        TEST_ASSERT_FLOAT_WITHIN(0.02, gbj_apphelpers::calculateDewpoint(rhums[i] / 10.0, -228.69),
+                                 gbj_apphelpers::calculateDewpointFixed(rhums[i], -22869) / 100.0);
+    }
+}
+
+void test_Psychrometrics(void)
+{
+    gbj_apphelpers::Psychrometrics air = gbj_apphelpers::calculatePsychrometrics(55.00, 25.00);
+    TEST_ASSERT_FLOAT_WITHIN(0.001, 15.36, air.dewpoint);
+    TEST_ASSERT_FLOAT_WITHIN(0.1, 25.0, air.heatIndex);
+    TEST_ASSERT_FLOAT_WITHIN(0.1, 12.6, air.absoluteHumidity);
+    TEST_ASSERT_FLOAT_WITHIN(0.1, 29.0, air.humidex);
+    air = gbj_apphelpers::calculatePsychrometrics(78.40, 20.30);
+    TEST_ASSERT_FLOAT_WITHIN(0.001, 16.43, air.dewpoint);
+    // Hot and humid air from NOAA heat index table, i.e., 90 F and 70 %
+    air = gbj_apphelpers::calculatePsychrometrics(70.0, 32.22);
+    TEST_ASSERT_FLOAT_WITHIN(0.5, 41.1, air.heatIndex);
+    TEST_ASSERT_FLOAT_WITHIN(0.7, 45.8, air.humidex);
+}
+
+void test_PsychrometricsScalar(void)
+{
+    for (float temp = -30.0; temp < 45.0; temp += 3.7)
+    {
+        for (float rhum = 5.0; rhum <= 100.0; rhum += 9.5)
+        {
+            gbj_apphelpers::Psychrometrics air = gbj_apphelpers::calculatePsychrometrics(rhum, temp);
+            TEST_ASSERT_EQUAL_FLOAT(gbj_apphelpers::calculateDewpoint(rhum, temp), air.dewpoint);
+            TEST_ASSERT_EQUAL_FLOAT(gbj_apphelpers::calculateHeatIndex(rhum, temp), air.heatIndex);
+            TEST_ASSERT_EQUAL_FLOAT(gbj_apphelpers::calculateAbsoluteHumidity(rhum, temp), air.absoluteHumidity);
+            TEST_ASSERT_EQUAL_FLOAT(gbj_apphelpers::calculateHumidex(rhum, temp), air.humidex);
+        }
+    }
+}
+
+void test_PsychrometricsInvalid(void)
+{
+    gbj_apphelpers::Psychrometrics air = gbj_apphelpers::calculatePsychrometrics(0.0, 25.0);
+    TEST_ASSERT_EQUAL_FLOAT(-999.0, air.dewpoint);
+    TEST_ASSERT_EQUAL_FLOAT(-999.0, air.heatIndex);
+    TEST_ASSERT_EQUAL_FLOAT(-999.0, air.absoluteHumidity);
+    TEST_ASSERT_EQUAL_FLOAT(-999.0, air.humidex);
+    TEST_ASSERT_EQUAL_FLOAT(-999.0, gbj_apphelpers::calculateHumidex(50.0, -300.0));
+    TEST_ASSERT_EQUAL_FLOAT(-999.0, gbj_apphelpers::calculateDewpoint(50.0, -300.0));
+}
 
 void setup() {
     UNITY_BEGIN();
@@ -43,6 +186,14 @@ void setup() {
     RUN_TEST(test_Celsius2Fahrenheit);
     RUN_TEST(test_Fahrenheit2Celsius);
     RUN_TEST(test_Dewpoint);
+    RUN_TEST(test_Celsius2FahrenheitArray);
+    RUN_TEST(test_Fahrenheit2CelsiusArray);
+    RUN_TEST(test_DewpointArray);
+    RUN_TEST(test_TemperatureFixed);
+    RUN_TEST(test_DewpointFixed);
+    RUN_TEST(test_Psychrometrics);
+    RUN_TEST(test_PsychrometricsScalar);
+    RUN_TEST(test_PsychrometricsInvalid);
 
     UNITY_END();
 }
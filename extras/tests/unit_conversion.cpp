@@ -0,0 +1,144 @@
+/*
+  NAME:
+  Unit tests of library "gbj_apphelpers" for compile time units.
+
+  DESCRIPTION:
+  The test suite provides test cases related to conversion of values and
+  quantities between units of temperature, pressure, length, and time.
+  - Conversions of constant quantities are checked at compile time as well.
+  - Conversions between different dimensions are compile errors, so that
+    they cannot be tested at runtime.
+  - The test runner is Unity Project - ThrowTheSwitch.org.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include <Arduino.h>
+#include <gbj_apphelpers.h>
+#include <unity.h>
+
+using Helpers = gbj_apphelpers;
+
+// Conversions of constants are evaluated at compile time
+static_assert(Helpers::convertUnit<Helpers::UnitFahrenheit,
+                                   Helpers::UnitCelsius>(212) == 100,
+              "Boiling point in Celsius");
+static_assert(Helpers::convertUnit<Helpers::UnitCelsius,
+                                   Helpers::UnitFahrenheit>(100) == 212,
+              "Boiling point in Fahrenheit");
+static_assert(Helpers::convertUnit<Helpers::UnitMillisecond,
+                                   Helpers::UnitSecond>(1500UL) == 2,
+              "Rounded seconds");
+static_assert(sizeof(Helpers::Quantity<Helpers::UnitCelsius>) == sizeof(float),
+              "Zero overhead quantity");
+
+void test_temperature(void)
+{
+  constexpr Helpers::Quantity<Helpers::UnitCelsius> temp(25.3);
+  constexpr Helpers::Quantity<Helpers::UnitFahrenheit> tempF = temp;
+  TEST_ASSERT_EQUAL_FLOAT(77.54, tempF.value());
+  TEST_ASSERT_EQUAL_FLOAT(298.45, temp.to<Helpers::UnitKelvin>().value());
+  TEST_ASSERT_EQUAL_FLOAT(25.3, tempF.to<Helpers::UnitCelsius>().value());
+  // The same results as the particular methods
+  for (float value = -40.0; value < 100.0; value += 7.3)
+  {
+    TEST_ASSERT_EQUAL_FLOAT(
+      gbj_apphelpers::convertCelsius2Fahrenheit(value),
+      (Helpers::convertUnit<Helpers::UnitCelsius, Helpers::UnitFahrenheit>(
+        value)));
+    TEST_ASSERT_EQUAL_FLOAT(
+      gbj_apphelpers::convertFahrenheit2Celsius(value),
+      (Helpers::convertUnit<Helpers::UnitFahrenheit, Helpers::UnitCelsius>(
+        value)));
+  }
+}
+
+void test_temperature_integer(void)
+{
+  TEST_ASSERT_EQUAL_INT32(
+    -40,
+    (Helpers::convertUnit<Helpers::UnitCelsius, Helpers::UnitFahrenheit>(
+      -40L)));
+  // -17.78 rounded half away from zero
+  TEST_ASSERT_EQUAL_INT32(
+    -18,
+    (Helpers::convertUnit<Helpers::UnitFahrenheit, Helpers::UnitCelsius>(0L)));
+  TEST_ASSERT_EQUAL_INT32(
+    273, (Helpers::convertUnit<Helpers::UnitCelsius, Helpers::UnitKelvin>(0L)));
+}
+
+void test_pressure(void)
+{
+  Helpers::Quantity<Helpers::UnitHectoPascal, double> pressure(1013.25);
+  TEST_ASSERT_FLOAT_WITHIN(
+    0.001, 760.0, pressure.to<Helpers::UnitMillimeterMercury>().value());
+  TEST_ASSERT_FLOAT_WITHIN(
+    0.0001, 29.9213, pressure.to<Helpers::UnitInchMercury>().value());
+  TEST_ASSERT_FLOAT_WITHIN(
+    0.001, 101325.0, pressure.to<Helpers::UnitPascal>().value());
+  TEST_ASSERT_EQUAL_UINT32(
+    1013,
+    (Helpers::convertUnit<Helpers::UnitPascal, Helpers::UnitHectoPascal>(
+      101325UL)));
+}
+
+void test_length_time(void)
+{
+  Helpers::Quantity<Helpers::UnitFoot> height(1000.0);
+  TEST_ASSERT_EQUAL_FLOAT(304.8, height.to<Helpers::UnitMeter>().value());
+  TEST_ASSERT_EQUAL_UINT32(
+    gbj_apphelpers::convertMs2Sec(12499),
+    (Helpers::convertUnit<Helpers::UnitMillisecond, Helpers::UnitSecond>(
+      12499UL)));
+  TEST_ASSERT_EQUAL_UINT32(
+    gbj_apphelpers::convertMs2Sec(12500),
+    (Helpers::convertUnit<Helpers::UnitMillisecond, Helpers::UnitSecond>(
+      12500UL)));
+  TEST_ASSERT_EQUAL_INT32(
+    -2,
+    (Helpers::convertUnit<Helpers::UnitMillisecond, Helpers::UnitSecond>(
+      -1500L)));
+  TEST_ASSERT_EQUAL_INT32(
+    -1,
+    (Helpers::convertUnit<Helpers::UnitMillisecond, Helpers::UnitSecond>(
+      -1499L)));
+  TEST_ASSERT_EQUAL_UINT32(
+    3000,
+    (Helpers::convertUnit<Helpers::UnitSecond, Helpers::UnitMillisecond>(3UL)));
+}
+
+void test_pressure_altitude(void)
+{
+  Helpers::Quantity<Helpers::UnitHectoPascal> pressure(898.75);
+  Helpers::Quantity<Helpers::UnitInchMercury> pressureSea(29.9213);
+  TEST_ASSERT_FLOAT_WITHIN(
+    0.1,
+    1000.1,
+    gbj_apphelpers::calculateAltitudeFromPressures(pressure, pressureSea)
+      .value());
+  Helpers::Quantity<Helpers::UnitFoot> altitude(3280.84);
+  TEST_ASSERT_FLOAT_WITHIN(
+    0.01,
+    1013.24,
+    gbj_apphelpers::calculatePressureSeaFromAltitude(pressure, altitude)
+      .value());
+}
+
+void setup()
+{
+  UNITY_BEGIN();
+
+  RUN_TEST(test_temperature);
+  RUN_TEST(test_temperature_integer);
+  RUN_TEST(test_pressure);
+  RUN_TEST(test_length_time);
+  RUN_TEST(test_pressure_altitude);
+
+  UNITY_END();
+}
+
+void loop() {}
@@ -0,0 +1,109 @@
+/*
+  NAME:
+  Unit tests of library "gbj_apphelpers" for uptime counter.
+
+  DESCRIPTION:
+  The test suite provides test cases related to cummulating of uptime by
+  independent counters including the overflow of milliseconds timer.
+  - The milliseconds timer is simulated by the host Arduino core.
+  - The test runner is Unity Project - ThrowTheSwitch.org.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include <Arduino.h>
+#include <gbj_apphelpers.h>
+#include <unity.h>
+
+void test_uptime_initial(void)
+{
+  gbj_apphelpers::UptimeCounter uptime;
+  TEST_ASSERT_EQUAL_UINT64(0, uptime.getMs());
+  TEST_ASSERT_EQUAL_UINT32(0, uptime.getSeconds());
+}
+
+void test_uptime_seconds(void)
+{
+  gbj_apphelpers::UptimeCounter uptime;
+  uint32_t ms = 0;
+  // Small steps accumulate seconds without division
+  for (uint16_t i = 0; i < 1000; i++)
+  {
+    ms += 7;
+    uptime.update(ms);
+    TEST_ASSERT_EQUAL_UINT32(ms / 1000, uptime.getSeconds());
+  }
+  TEST_ASSERT_EQUAL_UINT64(7000, uptime.getMs());
+  // Long step
+  uptime.update(ms + 123456);
+  TEST_ASSERT_EQUAL_UINT64(130456, uptime.getMs());
+  TEST_ASSERT_EQUAL_UINT32(130, uptime.getSeconds());
+  // No change
+  uptime.update(ms + 123456);
+  TEST_ASSERT_EQUAL_UINT64(130456, uptime.getMs());
+}
+
+void test_uptime_overflow(void)
+{
+  gbj_apphelpers::UptimeCounter uptime(UINT32_MAX - 1499);
+  uptime.update(UINT32_MAX);
+  TEST_ASSERT_EQUAL_UINT64(1499, uptime.getMs());
+  TEST_ASSERT_EQUAL_UINT32(1, uptime.getSeconds());
+  uptime.update(500);
+  TEST_ASSERT_EQUAL_UINT64(2000, uptime.getMs());
+  TEST_ASSERT_EQUAL_UINT32(2, uptime.getSeconds());
+  // Several overflows beyond 32-bit milliseconds
+  for (uint8_t i = 0; i < 6; i++)
+  {
+    uptime.update(UINT32_MAX / 2 + 500);
+    uptime.update(500);
+  }
+  uint64_t expected = 2000 + 6ULL * (UINT32_MAX + 1ULL);
+  TEST_ASSERT_EQUAL_UINT64(expected, uptime.getMs());
+  TEST_ASSERT_EQUAL_UINT32(expected / 1000, uptime.getSeconds());
+}
+
+void test_uptime_instances(void)
+{
+  gbj_apphelpers::UptimeCounter uptime1;
+  gbj_apphelpers::UptimeCounter uptime2(5000);
+  uptime1.update(8000);
+  uptime2.update(8000);
+  TEST_ASSERT_EQUAL_UINT64(8000, uptime1.getMs());
+  TEST_ASSERT_EQUAL_UINT64(3000, uptime2.getMs());
+  uptime2.reset(8000);
+  uptime1.update(9000);
+  uptime2.update(9000);
+  TEST_ASSERT_EQUAL_UINT32(9, uptime1.getSeconds());
+  TEST_ASSERT_EQUAL_UINT32(1, uptime2.getSeconds());
+}
+
+void test_uptime_millis(void)
+{
+  hostClockSet(UINT32_MAX - 999);
+  gbj_apphelpers::UptimeCounter uptime(millis());
+  hostClockAdvance(2500);
+  uptime.update();
+  hostClockRelease();
+  TEST_ASSERT_EQUAL_UINT64(2500, uptime.getMs());
+  TEST_ASSERT_EQUAL_UINT32(2, uptime.getSeconds());
+}
+
+void setup()
+{
+  UNITY_BEGIN();
+
+  RUN_TEST(test_uptime_initial);
+  RUN_TEST(test_uptime_seconds);
+  RUN_TEST(test_uptime_overflow);
+  RUN_TEST(test_uptime_instances);
+  RUN_TEST(test_uptime_millis);
+
+  UNITY_END();
+}
+
+void loop() {}
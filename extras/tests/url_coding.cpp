@@ -0,0 +1,268 @@
+/*
+  NAME:
+  Unit tests of library "gbj_apphelpers" for URL encoding and decoding.
+
+  DESCRIPTION:
+  The test suite provides test cases related to URL encoding and decoding
+  of Strings as well as of character buffers and streams into print sinks.
+  - The test runner is Unity Project - ThrowTheSwitch.org.
+
+  LICENSE:
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the MIT License (MIT).
+
+  CREDENTIALS:
+  Author: Libor Gabaj
+*/
+#include <Arduino.h>
+#include <unity.h>
+#include <gbj_apphelpers.h>
+
+// Print sink collecting characters into a String
+class StringSink : public Print
+{
+public:
+  String text;
+  size_t writes = 0;
+  size_t write(uint8_t c)
+  {
+    text += static_cast<char>(c);
+    return 1;
+  }
+  size_t write(const uint8_t *buffer, size_t size)
+  {
+    writes++;
+    return Print::write(buffer, size);
+  }
+};
+
+// Stream source providing characters from a buffer
+class BufferStream : public Stream
+{
+public:
+  BufferStream(const char *text)
+    : text_(text)
+    , pos_(0)
+  {
+  }
+  int available() { return strlen(text_) - pos_; }
+  int read() { return available() > 0 ? text_[pos_++] : -1; }
+  int peek() { return available() > 0 ? text_[pos_] : -1; }
+  size_t write(uint8_t c) { return 0; }
+
+private:
+  const char *text_;
+  size_t pos_;
+};
+
+const char plain[] = "Sensor OK, boot #12 ~ 100% [done]";
+const char encoded[] =
+  "Sensor+OK%2C+boot+%2312+%7E+100%25+%5Bdone%5D";
+
+void test_urlencode_string(void)
+{
+  TEST_ASSERT_EQUAL_STRING(encoded, gbj_apphelpers::urlencode(plain).c_str());
+}
+
+void test_urldecode_string(void)
+{
+  TEST_ASSERT_EQUAL_STRING(plain, gbj_apphelpers::urldecode(encoded).c_str());
+}
+
+void test_urlencode_modes(void)
+{
+  const char text[] = "a-b_c.d~e*f g+h";
+  TEST_ASSERT_EQUAL_STRING(
+    "a%2Db%5Fc%2Ed%7Ee%2Af+g%2Bh",
+    gbj_apphelpers::urlencode(text, gbj_apphelpers::URLMODE_ALNUM).c_str());
+  TEST_ASSERT_EQUAL_STRING(
+    "a-b_c.d%7Ee*f+g%2Bh",
+    gbj_apphelpers::urlencode(text, gbj_apphelpers::URLMODE_FORM).c_str());
+  TEST_ASSERT_EQUAL_STRING(
+    "a-b_c.d~e%2Af%20g%2Bh",
+    gbj_apphelpers::urlencode(text, gbj_apphelpers::URLMODE_RFC3986).c_str());
+  // Characters above 127
+  TEST_ASSERT_EQUAL_STRING(
+    "%C3%A9", gbj_apphelpers::urlencode("\xC3\xA9").c_str());
+}
+
+void test_urlencode_modes_sink(void)
+{
+  const char text[] = "a-b_c.d~e*f g+h";
+  StringSink sink;
+  TEST_ASSERT_EQUAL_UINT32(
+    21,
+    gbj_apphelpers::urlencode(
+      sink, text, strlen(text), gbj_apphelpers::URLMODE_RFC3986));
+  TEST_ASSERT_EQUAL_STRING("a-b_c.d~e%2Af%20g%2Bh", sink.text.c_str());
+  TEST_ASSERT_EQUAL_UINT32(
+    21,
+    gbj_apphelpers::urlencodeLength(
+      text, strlen(text), gbj_apphelpers::URLMODE_RFC3986));
+  TEST_ASSERT_EQUAL_UINT32(
+    19,
+    gbj_apphelpers::urlencodeLength(
+      text, strlen(text), gbj_apphelpers::URLMODE_FORM));
+}
+
+void test_urlencode_runs(void)
+{
+  // Runs of unescaped characters longer than a chunk
+  char text[301];
+  memset(text, 'x', 300);
+  text[300] = '\0';
+  text[100] = ' ';
+  text[299] = ',';
+  StringSink sink;
+  TEST_ASSERT_EQUAL_UINT32(302, gbj_apphelpers::urlencode(sink, text, 300));
+  TEST_ASSERT_EQUAL_STRING(gbj_apphelpers::urlencode(text).c_str(),
+                           sink.text.c_str());
+}
+
+void test_urlencode_length(void)
+{
+  TEST_ASSERT_EQUAL_UINT32(
+    strlen(encoded), gbj_apphelpers::urlencodeLength(plain, strlen(plain)));
+  TEST_ASSERT_EQUAL_UINT32(0, gbj_apphelpers::urlencodeLength(plain, 0));
+}
+
+void test_urlencode_sink(void)
+{
+  StringSink sink;
+  TEST_ASSERT_EQUAL_UINT32(
+    strlen(encoded), gbj_apphelpers::urlencode(sink, plain, strlen(plain)));
+  TEST_ASSERT_EQUAL_STRING(encoded, sink.text.c_str());
+}
+
+void test_urldecode_sink(void)
+{
+  StringSink sink;
+  TEST_ASSERT_EQUAL_UINT32(
+    strlen(plain), gbj_apphelpers::urldecode(sink, encoded, strlen(encoded)));
+  TEST_ASSERT_EQUAL_STRING(plain, sink.text.c_str());
+  // Truncated escape sequence is kept
+  sink.text = "";
+  TEST_ASSERT_EQUAL_UINT32(4, gbj_apphelpers::urldecode(sink, "a+%4", 4));
+  TEST_ASSERT_EQUAL_STRING("a %4", sink.text.c_str());
+}
+
+void test_urlencode_stream(void)
+{
+  StringSink sink;
+  BufferStream source(plain);
+  TEST_ASSERT_EQUAL_UINT32(strlen(encoded),
+                           gbj_apphelpers::urlencode(sink, source));
+  TEST_ASSERT_EQUAL_STRING(encoded, sink.text.c_str());
+}
+
+void test_urldecode_stream(void)
+{
+  StringSink sink;
+  BufferStream source(encoded);
+  TEST_ASSERT_EQUAL_UINT32(strlen(plain),
+                           gbj_apphelpers::urldecode(sink, source));
+  TEST_ASSERT_EQUAL_STRING(plain, sink.text.c_str());
+}
+
+void test_urldecode_in_place(void)
+{
+  char buffer[sizeof(encoded)];
+  size_t malformed = 99;
+  strcpy(buffer, encoded);
+  TEST_ASSERT_EQUAL_UINT32(
+    strlen(plain),
+    gbj_apphelpers::urldecode(buffer, strlen(buffer), &malformed));
+  TEST_ASSERT_EQUAL_STRING(plain, buffer);
+  TEST_ASSERT_EQUAL_UINT32(0, malformed);
+  // Lower case hexadecimal digits
+  strcpy(buffer, "%7e%2C");
+  TEST_ASSERT_EQUAL_UINT32(2, gbj_apphelpers::urldecode(buffer, 6));
+  TEST_ASSERT_EQUAL_STRING("~,", buffer);
+}
+
+void test_urldecode_malformed(void)
+{
+  char buffer[] = "a%G1+%4";
+  size_t malformed = 0;
+  TEST_ASSERT_EQUAL_UINT32(
+    7, gbj_apphelpers::urldecode(buffer, strlen(buffer), &malformed));
+  TEST_ASSERT_EQUAL_STRING("a%G1 %4", buffer);
+  TEST_ASSERT_EQUAL_UINT32(2, malformed);
+  char single[] = "%";
+  TEST_ASSERT_EQUAL_UINT32(1, gbj_apphelpers::urldecode(single, 1, &malformed));
+  TEST_ASSERT_EQUAL_UINT32(1, malformed);
+  // Only provided length is decoded, even the escape in the buffer is valid
+  char partial[] = "%41%42";
+  TEST_ASSERT_EQUAL_UINT32(
+    3, gbj_apphelpers::urldecode(partial, 5, &malformed));
+  TEST_ASSERT_EQUAL_STRING("A%4", partial);
+  TEST_ASSERT_EQUAL_UINT32(1, malformed);
+  // Sink and stream variants keep malformed escapes the same way
+  const char *inputs[] = { "a%G1+%4", "%zz%20", "%%41", "100%", "%4%2C" };
+  const char *outputs[] = { "a%G1 %4", "%zz ", "%A", "100%", "%4," };
+  const size_t counts[] = { 2, 1, 1, 1, 1 };
+  for (uint8_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++)
+  {
+    StringSink sink;
+    malformed = 99;
+    TEST_ASSERT_EQUAL_UINT32(
+      strlen(outputs[i]),
+      gbj_apphelpers::urldecode(
+        sink, inputs[i], strlen(inputs[i]), &malformed));
+    TEST_ASSERT_EQUAL_STRING(outputs[i], sink.text.c_str());
+    TEST_ASSERT_EQUAL_UINT32(counts[i], malformed);
+    StringSink streamSink;
+    BufferStream source(inputs[i]);
+    malformed = 99;
+    gbj_apphelpers::urldecode(streamSink, source, &malformed);
+    TEST_ASSERT_EQUAL_STRING(outputs[i], streamSink.text.c_str());
+    TEST_ASSERT_EQUAL_UINT32(counts[i], malformed);
+    // The same as in place
+    char buffer[16];
+    strcpy(buffer, inputs[i]);
+    gbj_apphelpers::urldecode(buffer, strlen(buffer));
+    TEST_ASSERT_EQUAL_STRING(outputs[i], buffer);
+  }
+}
+
+void test_chunks(void)
+{
+  // Every character encoded into 3 ones, i.e., 300 characters
+  char text[100];
+  memset(text, ',', sizeof(text));
+  StringSink sink;
+  TEST_ASSERT_EQUAL_UINT32(
+    300, gbj_apphelpers::urlencode(sink, text, sizeof(text)));
+  TEST_ASSERT_EQUAL_UINT32(300, sink.text.length());
+  // Written by chunks, not by characters
+  TEST_ASSERT_LESS_THAN_UINT32(10, sink.writes);
+  String chunked = sink.text;
+  sink.text = "";
+  TEST_ASSERT_EQUAL_UINT32(
+    100, gbj_apphelpers::urldecode(sink, chunked.c_str(), chunked.length()));
+  TEST_ASSERT_EQUAL_UINT32(100, sink.text.length());
+  TEST_ASSERT_EQUAL_INT(',', sink.text.charAt(99));
+}
+
+void setup()
+{
+  UNITY_BEGIN();
+
+  RUN_TEST(test_urlencode_string);
+  RUN_TEST(test_urldecode_string);
+  RUN_TEST(test_urlencode_modes);
+  RUN_TEST(test_urlencode_modes_sink);
+  RUN_TEST(test_urlencode_runs);
+  RUN_TEST(test_urlencode_length);
+  RUN_TEST(test_urlencode_sink);
+  RUN_TEST(test_urldecode_sink);
+  RUN_TEST(test_urlencode_stream);
+  RUN_TEST(test_urldecode_stream);
+  RUN_TEST(test_urldecode_in_place);
+  RUN_TEST(test_urldecode_malformed);
+  RUN_TEST(test_chunks);
+
+  UNITY_END();
+}
+
+void loop() {}
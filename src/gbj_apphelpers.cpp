@@ -1,26 +1,382 @@
 #include "gbj_apphelpers.h"
+#if defined(__SSE2__)
+  #include <emmintrin.h>
+#elif defined(__ARM_NEON)
+  #include <arm_neon.h>
+#endif
+
+namespace
+{
+  // Names of built-in reboot sources separated by null characters and
+  // offsets of them in order of McuReboots codes
+  const char REBOOT_TEXTS[] PROGMEM = "Unknown\0"
+                                      "Permanent Error(s)\0"
+                                      "Wifi\0"
+                                      "WebServer\0"
+                                      "GoogleSpredsheets\0"
+                                      "Thermometer\0"
+                                      "Thingspeak";
+  const uint8_t REBOOT_OFFSETS[] PROGMEM = { 0, 8, 27, 32, 42, 60, 72 };
+
+  // Complement of the sum of record bytes except the checksum itself
+  inline uint8_t rebootChecksum(const uint8_t *record)
+  {
+    uint8_t sum = 0;
+    for (uint8_t i = 0; i < gbj_apphelpers::REBOOT_RECORD_SIZE - 1; i++)
+    {
+      sum += record[i];
+    }
+    return ~sum;
+  }
+
+  // Constants of Antoine equation for saturation vapour pressure of water in
+  // millimeters of mercury, log10(p) = A - B / (temp + C)
+  const float PSYCHRO_A = 8.1332;
+  const float PSYCHRO_B = 1762.39;
+  const float PSYCHRO_C = 235.66;
+  const float PSYCHRO_NAN = -999.0;
+
+  /*
+    Shared logarithmic term of psychrometric quantities.
+
+    The term is the decimal logarithm of partial pressure of water vapour
+    reduced by the constant A, i.e., at the same time it is the Antoine
+    equation term at dew point.
+  */
+  inline float psychroTerm(float rhum, float temp)
+  {
+    return log10(rhum) - 2.0 - (PSYCHRO_B / (temp + PSYCHRO_C));
+  }
+  inline bool psychroInvalid(float rhum, float temp)
+  {
+    return rhum <= 0.0 || temp <= -273.15;
+  }
+  inline float psychroDewpoint(float term)
+  {
+    return term == 0 ? PSYCHRO_NAN : -1.0 * (PSYCHRO_B / term + PSYCHRO_C);
+  }
+  // Partial pressure of water vapour in hectopascals
+  inline float psychroPressure(float term)
+  {
+    return pow(10.0, PSYCHRO_A + term) * 1.333224;
+  }
+  // Grams of water vapour in cubic meter from ideal gas law
+  inline float psychroAbsolute(float pressure, float temp)
+  {
+    return 216.7 * pressure / (temp + 273.15);
+  }
+  inline float psychroHumidex(float pressure, float temp)
+  {
+    return temp + 0.5555 * (pressure - 10.0);
+  }
+  // NOAA heat index algorithm in Fahrenheit
+  inline float psychroHeatIndex(float rhum, float temp)
+  {
+    float t = gbj_apphelpers::convertCelsius2Fahrenheit(temp);
+    float index = 0.5 * (t + 61.0 + (t - 68.0) * 1.2 + rhum * 0.094);
+    if ((index + t) / 2.0 >= 80.0)
+    {
+      // Rothfusz regression
+      index = -42.379 + 2.04901523 * t + 10.14333127 * rhum -
+              0.22475541 * t * rhum - 0.00683783 * t * t -
+              0.05481717 * rhum * rhum + 0.00122874 * t * t * rhum +
+              0.00085282 * t * rhum * rhum - 0.00000199 * t * t * rhum * rhum;
+      if (rhum < 13.0 && t >= 80.0 && t <= 112.0)
+      {
+        index -= (13.0 - rhum) / 4.0 * sqrt((17.0 - fabs(t - 95.0)) / 17.0);
+      }
+      else if (rhum > 85.0 && t >= 80.0 && t <= 87.0)
+      {
+        index += (rhum - 85.0) / 10.0 * (87.0 - t) / 5.0;
+      }
+    }
+    return gbj_apphelpers::convertFahrenheit2Celsius(index);
+  }
+}
 
 float gbj_apphelpers::calculateDewpoint(float rhum, float temp)
 {
-  // const float A = 8.1332;  // Just for partial pressure calculation
-  const float B = 1762.39;
-  const float C = 235.66;
-  const float NaN = -999.0;
   // Check input parameters
-  if (rhum <= 0.0)
-    return NaN;
-  if (temp <= -273.15)
-    return NaN;
-  if (temp == -1.0 * B)
-    return NaN;
+  if (psychroInvalid(rhum, temp))
+    return PSYCHRO_NAN;
   // Calculate
-  float dewpoint = log10(rhum) - 2.0 - (B / (temp + C));
-  if (dewpoint == 0)
+  return psychroDewpoint(psychroTerm(rhum, temp));
+}
+
+gbj_apphelpers::Psychrometrics gbj_apphelpers::calculatePsychrometrics(
+  float rhum,
+  float temp)
+{
+  Psychrometrics result;
+  if (psychroInvalid(rhum, temp))
+  {
+    return result;
+  }
+  float term = psychroTerm(rhum, temp);
+  float pressure = psychroPressure(term);
+  result.dewpoint = psychroDewpoint(term);
+  result.heatIndex = psychroHeatIndex(rhum, temp);
+  result.absoluteHumidity = psychroAbsolute(pressure, temp);
+  result.humidex = psychroHumidex(pressure, temp);
+  return result;
+}
+
+float gbj_apphelpers::calculateHeatIndex(float rhum, float temp)
+{
+  if (psychroInvalid(rhum, temp))
+  {
+    return PSYCHRO_NAN;
+  }
+  return psychroHeatIndex(rhum, temp);
+}
+
+float gbj_apphelpers::calculateAbsoluteHumidity(float rhum, float temp)
+{
+  if (psychroInvalid(rhum, temp))
+  {
+    return PSYCHRO_NAN;
+  }
+  return psychroAbsolute(psychroPressure(psychroTerm(rhum, temp)), temp);
+}
+
+float gbj_apphelpers::calculateHumidex(float rhum, float temp)
+{
+  if (psychroInvalid(rhum, temp))
+  {
+    return PSYCHRO_NAN;
+  }
+  return psychroHumidex(psychroPressure(psychroTerm(rhum, temp)), temp);
+}
+
+namespace
+{
+  // Binary logarithms of 1 + i / 64 in Q16 format for i = 0 ~ 63
+  const uint16_t log2Table[64] PROGMEM = {
+    0,     1466,  2909,  4331,  5732,  7112,  8473,  9814,  11136, 12440,
+    13727, 14996, 16248, 17484, 18704, 19909, 21098, 22272, 23433, 24579,
+    25711, 26830, 27936, 29029, 30109, 31178, 32234, 33279, 34312, 35334,
+    36346, 37346, 38336, 39316, 40286, 41246, 42196, 43137, 44068, 44990,
+    45904, 46809, 47705, 48593, 49472, 50344, 51207, 52063, 52911, 53751,
+    54584, 55410, 56229, 57040, 57845, 58643, 59434, 60219, 60997, 61769,
+    62534, 63294, 64047, 64794,
+  };
+  // Minimax polynomial of 1 - (1 + x)^(1 / 5.255) for x = -0.7 ~ 0.1 with
+  // coefficients from the lowest power in Q24 format
+  const int64_t altitudePoly[10] PROGMEM = {
+    -1,       -3192676, 1293250,   -764115,   545131,
+    -1399621, -5561038, -15532843, -18804066, -9852265,
+  };
+  // Minimax polynomial of (1 - y)^(-5.255) for y = -0.02 ~ 0.2 with
+  // coefficients from the lowest power in Q24 format
+  const int64_t pressurePoly[8] PROGMEM = {
+    16777215,   88163545,   275749566,   668358068,
+    1314543405, 3424366580, -1439870963, 23761732438,
+  };
+  const int32_t Q16 = 65536L;
+  const int32_t Q24 = 16777216L;
+
+  /*
+    Binary logarithm of a positive integer in Q16 format.
+
+    The integer is normalized to the mantissa 1 ~ 2 and its logarithm
+    is interpolated linearly in the table with error below 0.00005.
+  */
+  int32_t log2Fixed(uint32_t x)
+  {
+    int32_t exponent = 31;
+    while (!(x & 0x80000000UL))
+    {
+      x <<= 1;
+      exponent--;
+    }
+    uint8_t idx = (x >> 25) & 0x3F;
+    uint32_t frac = (x >> 9) & 0xFFFF;
+    uint32_t lo = pgm_read_word(&log2Table[idx]);
+    uint32_t hi = idx < 63 ? pgm_read_word(&log2Table[idx + 1]) : Q16;
+    return exponent * Q16 + lo + (((hi - lo) * frac) >> 16);
+  }
+
+  /*
+    Quotient of integers in fixed point format with provided fraction bits.
+
+    Long division by 8 bits in 32-bit arithmetic requires the divisor less
+    than 2^24 and the integer part of quotient less than 2^(32 - bits).
+  */
+  uint32_t divideFixed(uint32_t dividend, uint32_t divisor, uint8_t bits)
+  {
+    uint32_t quotient = dividend / divisor;
+    uint32_t remainder = dividend % divisor;
+    for (uint8_t i = 0; i < bits; i += 8)
+    {
+      remainder <<= 8;
+      quotient = (quotient << 8) | (remainder / divisor);
+      remainder %= divisor;
+    }
+    return quotient;
+  }
+
+  // Horner scheme for argument and coefficients in Q24 format
+  int64_t polynomialFixed(const int64_t *coefs, uint8_t degree, int64_t x)
+  {
+    int64_t coef;
+    memcpy_P(&coef, &coefs[degree], sizeof(coef));
+    int64_t result = coef;
+    while (degree--)
+    {
+      memcpy_P(&coef, &coefs[degree], sizeof(coef));
+      result = coef + ((result * x) >> 24);
+    }
+    return result;
+  }
+}
+
+int32_t gbj_apphelpers::calculateDewpointFixed(uint16_t rhum, int32_t temp)
+{
+  const int32_t NaN = -99900;
+  // Constants B and C of the Antoine equation in hundredths
+  const uint32_t B = 176239;
+  const int32_t C = 23566;
+  // Long divisions require divisors below 2^24, so that the quotient
+  // B / (temp + C) in Q16 with the logarithm term has to be below it
+  const int32_t DIVISOR_MIN = 697;
+  if (rhum == 0 || temp < DIVISOR_MIN - C || temp >= Q24 - C)
+  {
+    return NaN;
+  }
+  // Decimal logarithm of the relative humidity as a fraction
+  uint32_t log2Rhum = log2Fixed(rhum);
+  const uint32_t LOG10_2 = 19728;
+  int32_t term = (log2Rhum >> 16) * LOG10_2 +
+                 (((log2Rhum & 0xFFFF) * LOG10_2) >> 16) - 3 * Q16;
+  term -= divideFixed(B, temp + C, 16);
+  if (term >= 0)
+  {
     return NaN;
-  dewpoint = B / dewpoint + C;
-  return -1.0 * dewpoint;
+  }
+  return static_cast<int32_t>(divideFixed(B, -term, 16)) - C;
 }
 
+int32_t gbj_apphelpers::calculateAltitudeFromPressuresFixed(
+  uint32_t pressure,
+  uint32_t pressureSea)
+{
+  const int32_t X_MIN = -7 * Q24 / 10;
+  const int32_t X_MAX = Q24 / 10;
+  int32_t x = X_MAX;
+  if (pressureSea && pressure / pressureSea < 2)
+  {
+    x = divideFixed(pressure, pressureSea, 24) - Q24;
+  }
+  x = x < X_MIN ? X_MIN : (x > X_MAX ? X_MAX : x);
+  // Altitude factor 44330 m in centimeters
+  return (polynomialFixed(altitudePoly, 9, x) * 4433000 + Q24 / 2) >> 24;
+}
+
+uint32_t gbj_apphelpers::calculatePressureSeaFromAltitudeFixed(
+  uint32_t pressure,
+  int32_t altitude)
+{
+  // Altitude limits for y = altitude / 44330 m in centimeters
+  const int32_t ALT_MIN = -88660;
+  const int32_t ALT_MAX = 886600;
+  const uint32_t ALT_FACTOR = 4433000;
+  altitude = altitude < ALT_MIN ? ALT_MIN : altitude;
+  altitude = altitude > ALT_MAX ? ALT_MAX : altitude;
+  int32_t y = divideFixed(altitude < 0 ? -altitude : altitude, ALT_FACTOR, 24);
+  y = altitude < 0 ? -y : y;
+  return (polynomialFixed(pressurePoly, 7, y) * pressure + Q24 / 2) >> 24;
+}
+
+namespace
+{
+  /*
+    Decimal logarithm of a positive normal number without branches.
+
+    The number is split to binary exponent and mantissa in the range
+    sqrt(0.5) ~ sqrt(2) by integer arithmetic on its bits. Natural logarithm
+    of the mantissa is computed by the series 2 * atanh(s) with
+    s = (m - 1) / (m + 1) up to the 9th power, which is exact to float
+    precision.
+  */
+  inline float log10Kernel(float x)
+  {
+    const float LN2 = 0.693147181f;
+    const float LOG10E = 0.434294482f;
+    // Unsigned bits do not overflow for negative numbers, which are
+    // calculated in vectorized loops before being masked as invalid
+    uint32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    // Offset by the bits of sqrt(0.5) for the exponent of shifted mantissa
+    int32_t exponent = static_cast<int32_t>(bits - 0x3F3504F3UL) >> 23;
+    bits -= static_cast<uint32_t>(exponent) << 23;
+    float m;
+    memcpy(&m, &bits, sizeof(m));
+    float s = (m - 1.0f) / (m + 1.0f);
+    float s2 = s * s;
+    float ln =
+      2.0f * s *
+      (1.0f +
+       s2 * (1.0f / 3.0f +
+             s2 * (1.0f / 5.0f + s2 * (1.0f / 7.0f + s2 * (1.0f / 9.0f)))));
+    return (ln + exponent * LN2) * LOG10E;
+  }
+}
+
+size_t gbj_apphelpers::calculateDewpointArray(const float *rhum,
+                                              const float *temp,
+                                              float *dewpoint,
+                                              size_t dataLen)
+{
+  const float B = PSYCHRO_B;
+  const float C = PSYCHRO_C;
+  const float NaN = PSYCHRO_NAN;
+  // Compilers do not vectorize divisions, which are skipped for invalid
+  // items, so that divisions and replacements are in separate loops over
+  // small blocks of items
+  const size_t BLOCK = 16;
+  float divisor[BLOCK];
+  float value[BLOCK];
+  size_t count = 0;
+  for (size_t i = 0; i < dataLen; i += BLOCK)
+  {
+    size_t blockLen = dataLen - i < BLOCK ? dataLen - i : BLOCK;
+    for (size_t j = 0; j < blockLen; j++)
+    {
+      float d = log10Kernel(rhum[i + j]) - 2.0f - (B / (temp[i + j] + C));
+      divisor[j] = d;
+      value[j] = -(B / d + C);
+    }
+    for (size_t j = 0; j < blockLen; j++)
+    {
+      float r = rhum[i + j];
+      float t = temp[i + j];
+      bool invalid = (r <= 0.0f) | (t <= -273.15f) | (divisor[j] == 0.0f);
+      count += invalid;
+      dewpoint[i + j] = invalid ? NaN : value[j];
+    }
+  }
+  return count;
+}
+
+void gbj_apphelpers::convertCelsius2FahrenheitArray(const float *tempIn,
+                                                    float *tempOut,
+                                                    size_t dataLen)
+{
+  for (size_t i = 0; i < dataLen; i++)
+  {
+    tempOut[i] = tempIn[i] * 1.8f + 32.0f;
+  }
+}
+
+void gbj_apphelpers::convertFahrenheit2CelsiusArray(const float *tempIn,
+                                                    float *tempOut,
+                                                    size_t dataLen)
+{
+  for (size_t i = 0; i < dataLen; i++)
+  {
+    tempOut[i] = (tempIn[i] - 32.0f) * (5.0f / 9.0f);
+  }
+}
 
 void gbj_apphelpers::parseDate(Datetime &dtRecord, const char* strDate)
 {
@@ -65,6 +421,217 @@ void gbj_apphelpers::parseDate(Datetime &dtRecord, const char* strDate)
 }
 
 
+namespace
+{
+  // Two decimal digits as a number or -1 for other characters. A digit is
+  // read only after the previous one, so that the terminating null
+  // character stops reading of a short string.
+  inline int8_t parseNumber2(const char *p)
+  {
+    uint8_t hi = p[0] - '0';
+    if (hi > 9)
+    {
+      return -1;
+    }
+    uint8_t lo = p[1] - '0';
+    return lo > 9 ? -1 : 10 * hi + lo;
+  }
+
+  // Four decimal digits as a number or -1 for other characters
+  inline int16_t parseNumber4(const char *p)
+  {
+    int8_t hi = parseNumber2(&p[0]);
+    if (hi < 0)
+    {
+      return -1;
+    }
+    int8_t lo = parseNumber2(&p[2]);
+    return lo < 0 ? -1 : 100 * hi + lo;
+  }
+
+  // Index of a three letters name in the list of names or -1
+  int8_t parseName(const char *p, const char *names, uint8_t count)
+  {
+    for (uint8_t i = 0; i < count; i++, names += 3)
+    {
+      if (p[0] == names[0] && p[1] == names[1] && p[2] == names[2])
+      {
+        return i;
+      }
+    }
+    return -1;
+  }
+}
+
+gbj_apphelpers::ParseResults gbj_apphelpers::parseComplete(
+  Datetime &dtRecord,
+  unsigned long *epochSeconds,
+  uint16_t year,
+  uint8_t month,
+  uint8_t day,
+  uint8_t hour,
+  uint8_t minute,
+  uint8_t second,
+  long offset)
+{
+  const uint8_t daysOfMonth[] = { 31, 29, 31, 30, 31, 30,
+                                  31, 31, 30, 31, 30, 31 };
+  bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+  if (month < 1 || month > 12 || day < 1 || day > daysOfMonth[month - 1] ||
+      (month == 2 && day == 29 && !leap) || hour > 23 || minute > 59 ||
+      second > 59 || year < 1969 || year > 2106)
+  {
+    return PARSE_ERROR_RANGE;
+  }
+  // Offset can move datetime at the edges of years into the epoch range,
+  // so that days of 1969 are negative
+  int32_t days = daysFromCivil(year, month, day);
+  int64_t epoch = static_cast<int64_t>(days) * 86400L + hour * 3600L +
+                  minute * 60L + second - offset;
+  if (epoch < 0 || epoch > 4294967295LL)
+  {
+    return PARSE_ERROR_RANGE;
+  }
+  convertEpoch2Datetime(dtRecord, epoch);
+  if (epochSeconds)
+  {
+    *epochSeconds = epoch;
+  }
+  return PARSE_SUCCESS;
+}
+
+gbj_apphelpers::ParseResults gbj_apphelpers::parseIso8601(
+  Datetime &dtRecord,
+  const char *str,
+  unsigned long *epochSeconds)
+{
+  // Date "YYYY-MM-DD"
+  int16_t year = parseNumber4(&str[0]);
+  if (year < 0 || str[4] != '-')
+  {
+    return PARSE_ERROR_FORMAT;
+  }
+  int8_t month = parseNumber2(&str[5]);
+  if (month < 0 || str[7] != '-')
+  {
+    return PARSE_ERROR_FORMAT;
+  }
+  int8_t day = parseNumber2(&str[8]);
+  if (day < 0)
+  {
+    return PARSE_ERROR_FORMAT;
+  }
+  str += 10;
+  int8_t hour = 0, minute = 0, second = 0;
+  long offset = 0;
+  if (*str == 'T' || *str == 't' || *str == ' ')
+  {
+    // Time "HH:MM[:SS[.fraction]]"
+    hour = parseNumber2(&str[1]);
+    if (hour < 0 || str[3] != ':')
+    {
+      return PARSE_ERROR_FORMAT;
+    }
+    minute = parseNumber2(&str[4]);
+    if (minute < 0)
+    {
+      return PARSE_ERROR_FORMAT;
+    }
+    str += 6;
+    if (*str == ':')
+    {
+      second = parseNumber2(&str[1]);
+      if (second < 0)
+      {
+        return PARSE_ERROR_FORMAT;
+      }
+      str += 3;
+      if (*str == '.' || *str == ',')
+      {
+        if (static_cast<uint8_t>(*++str - '0') > 9)
+        {
+          return PARSE_ERROR_FORMAT;
+        }
+        while (static_cast<uint8_t>(*str - '0') <= 9)
+        {
+          str++;
+        }
+      }
+    }
+    // Offset "Z", "+HH:MM", "+HHMM", "+HH"
+    if (*str == 'Z' || *str == 'z')
+    {
+      str++;
+    }
+    else if (*str == '+' || *str == '-')
+    {
+      int8_t offsetHour = parseNumber2(&str[1]);
+      if (offsetHour < 0)
+      {
+        return PARSE_ERROR_FORMAT;
+      }
+      int8_t offsetMinute = 0;
+      const char *p = &str[3];
+      // Minutes are required after a colon
+      bool colon = *p == ':';
+      p += colon;
+      if (colon || *p != '\0')
+      {
+        offsetMinute = parseNumber2(p);
+        if (offsetMinute < 0)
+        {
+          return PARSE_ERROR_FORMAT;
+        }
+        p += 2;
+      }
+      if (offsetHour > 23 || offsetMinute > 59)
+      {
+        return PARSE_ERROR_RANGE;
+      }
+      offset = offsetHour * 3600L + offsetMinute * 60L;
+      if (*str == '-')
+      {
+        offset = -offset;
+      }
+      str = p;
+    }
+  }
+  if (*str != '\0')
+  {
+    return PARSE_ERROR_FORMAT;
+  }
+  return parseComplete(
+    dtRecord, epochSeconds, year, month, day, hour, minute, second, offset);
+}
+
+gbj_apphelpers::ParseResults gbj_apphelpers::parseRfc1123(
+  Datetime &dtRecord,
+  const char *str,
+  unsigned long *epochSeconds)
+{
+  // "Sun, 06 Nov 1994 08:49:37 GMT"
+  if (strlen(str) != 29 || str[3] != ',' || str[4] != ' ' || str[7] != ' ' ||
+      str[11] != ' ' || str[16] != ' ' || str[19] != ':' || str[22] != ':' ||
+      strcmp(&str[25], " GMT") != 0 ||
+      parseName(&str[0], "MonTueWedThuFriSatSun", 7) < 0)
+  {
+    return PARSE_ERROR_FORMAT;
+  }
+  int8_t day = parseNumber2(&str[5]);
+  int8_t month = parseName(&str[8], "JanFebMarAprMayJunJulAugSepOctNovDec", 12);
+  int16_t year = parseNumber4(&str[12]);
+  int8_t hour = parseNumber2(&str[17]);
+  int8_t minute = parseNumber2(&str[20]);
+  int8_t second = parseNumber2(&str[23]);
+  if (day < 0 || month < 0 || year < 0 || hour < 0 || minute < 0 ||
+      second < 0)
+  {
+    return PARSE_ERROR_FORMAT;
+  }
+  return parseComplete(
+    dtRecord, epochSeconds, year, month + 1, day, hour, minute, second, 0);
+}
+
 void gbj_apphelpers::parseDateTime(Datetime &dtRecord, \
   const char* strDate, const char* strTime)
 {
@@ -83,49 +650,583 @@ void gbj_apphelpers::parseDateTime(Datetime &dtRecord,
   parseTime(dtRecord, buffer);
 }
 
-String gbj_apphelpers::urlencode(String str)
+void gbj_apphelpers::convertEpoch2Datetime(Datetime &dtRecord,
+                                           unsigned long epochSeconds)
 {
-  String encodedString = "";
-  char c;
-  char code0;
-  char code1;
-  // char code2;
-  for (word i = 0; i < str.length(); i++)
+  uint32_t days = epochSeconds / 86400UL;
+  uint32_t seconds = epochSeconds % 86400UL;
+  dtRecord.hour = seconds / 3600;
+  dtRecord.minute = (seconds % 3600) / 60;
+  dtRecord.second = seconds % 60;
+  dtRecord.mode12h = false;
+  dtRecord.pm = dtRecord.hour >= 12;
+  // 01.01.1970 was Thursday
+  dtRecord.weekday = (days + 3) % 7 + 1;
+  // Civil from days by H. Hinnant with years starting on 1st March, so that
+  // the leap day is the last day of a year. Shift to 01.03.0000.
+  uint32_t z = days + 719468UL;
+  uint32_t era = z / 146097UL;
+  uint32_t doe = z - era * 146097UL; // Day of era 0 ~ 146096
+  uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100); // 0 ~ 365
+  uint32_t mp = (5 * doy + 2) / 153; // Month from March 0 ~ 11
+  dtRecord.day = doy - (153 * mp + 2) / 5 + 1;
+  dtRecord.month = mp < 10 ? mp + 3 : mp - 9;
+  dtRecord.year = yoe + era * 400 + (dtRecord.month <= 2);
+}
+
+unsigned long gbj_apphelpers::convertDatetime2Epoch(const Datetime &dtRecord)
+{
+  uint16_t year = dtRecord.year < 100 ? dtRecord.year + 2000 : dtRecord.year;
+  uint8_t hour = dtRecord.hour;
+  if (dtRecord.mode12h)
   {
-    c = str.charAt(i);
-    if (c == ' ')
+    hour = (hour % 12) + (dtRecord.pm ? 12 : 0);
+  }
+  if (year < 1970)
+  {
+    return 0;
+  }
+  uint32_t days = daysFromCivil(year, dtRecord.month, dtRecord.day);
+  return days * 86400UL + hour * 3600UL + dtRecord.minute * 60UL +
+         dtRecord.second;
+}
+
+const char *gbj_apphelpers::EpochFormatter::format(unsigned long epochSeconds)
+{
+  uint32_t day = epochSeconds / 86400UL;
+  uint32_t second = epochSeconds % 86400UL;
+  if (day != day_)
+  {
+    // Render date prefix "dd.mm.yyyy " once a day
+    Datetime dtRecord;
+    convertEpoch2Datetime(dtRecord, epochSeconds);
+    formatDate(text_, dtRecord);
+    text_[10] = ' ';
+    text_[TIME_POS + 2] = text_[TIME_POS + 5] = ':';
+    text_[FORMAT_EPOCHSECONDS_LEN] = '\0';
+    day_ = day;
+  }
+  else if (second == second_)
+  {
+    return text_;
+  }
+  second_ = second;
+  uint8_t minutes = second / 60 % 60;
+  formatDigits(&text_[TIME_POS], second / 3600);
+  formatDigits(&text_[TIME_POS + 3], minutes);
+  formatDigits(&text_[TIME_POS + 6], second % 60);
+  return text_;
+}
+
+void gbj_apphelpers::UptimeCounter::reset(uint32_t startMs)
+{
+  lastMs_ = startMs;
+  remainderMs_ = 0;
+  counts_.ms = 0;
+  counts_.seconds = 0;
+  seq_ = 0;
+  latch_[0] = latch_[1] = counts_;
+}
+
+void gbj_apphelpers::UptimeCounter::update(uint32_t ms)
+{
+  // Modular difference is correct across the timer overflow
+  uint32_t elapsed = ms - lastMs_;
+  lastMs_ = ms;
+  if (elapsed == 0)
+  {
+    return;
+  }
+  counts_.ms += elapsed;
+  if (elapsed < 1000)
+  {
+    remainderMs_ += elapsed;
+  }
+  else
+  {
+    counts_.seconds += elapsed / 1000;
+    remainderMs_ += elapsed % 1000;
+  }
+  if (remainderMs_ >= 1000)
+  {
+    remainderMs_ -= 1000;
+    counts_.seconds++;
+  }
+  publish();
+}
+
+void gbj_apphelpers::UptimeCounter::publish()
+{
+  // Readers switch to the second copy while the first one is written
+  // and vice versa
+  seq_ = seq_ + 1;
+  barrierRelease();
+  latch_[0] = counts_;
+  barrierRelease();
+  seq_ = seq_ + 1;
+  barrierRelease();
+  latch_[1] = counts_;
+}
+
+const __FlashStringHelper *gbj_apphelpers::getRebootText(uint8_t code)
+{
+  const char *text = REBOOT_TEXTS;
+  if (code < MCUREBOOT_USER)
+  {
+    if (code < sizeof(REBOOT_OFFSETS))
     {
-      encodedString += '+';
+      text += pgm_read_byte(&REBOOT_OFFSETS[code]);
     }
-    else if (isalnum(c))
+  }
+  else
+  {
+    const __FlashStringHelper *user = getRebootTextUser(code - MCUREBOOT_USER);
+    if (user)
     {
-      encodedString += c;
+      return user;
+    }
+  }
+  return reinterpret_cast<const __FlashStringHelper *>(text);
+}
+
+// Overridden by the macro GBJ_APPHELPERS_REBOOTS in an application
+__attribute__((weak)) const __FlashStringHelper *
+gbj_apphelpers::getRebootTextUser(uint8_t)
+{
+  return NULL;
+}
+
+void gbj_apphelpers::packReboot(uint8_t *record,
+                                uint8_t seq,
+                                uint8_t reason,
+                                uint32_t uptime,
+                                uint32_t epoch,
+                                uint16_t count)
+{
+  const uint32_t UPTIME_MINUTES = 0x800000UL;
+  if (uptime >= UPTIME_MINUTES)
+  {
+    uptime /= 60;
+    uptime = UPTIME_MINUTES | (uptime < UPTIME_MINUTES ? uptime
+                                                       : UPTIME_MINUTES - 1);
+  }
+  record[0] = seq;
+  record[1] = reason;
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    record[2 + i] = uptime >> (8 * i);
+  }
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    record[5 + i] = epoch >> (8 * i);
+  }
+  record[9] = count;
+  record[10] = count >> 8;
+  record[REBOOT_RECORD_SIZE - 1] = rebootChecksum(record);
+}
+
+void gbj_apphelpers::unpackReboot(const uint8_t *record,
+                                  RebootRecord &rebootRecord)
+{
+  rebootRecord.reason = record[1];
+  uint32_t uptime = record[2] | static_cast<uint32_t>(record[3]) << 8 |
+                    static_cast<uint32_t>(record[4]) << 16;
+  rebootRecord.uptime = uptime & 0x800000UL ? (uptime & 0x7FFFFFUL) * 60
+                                            : uptime;
+  rebootRecord.epoch = 0;
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    rebootRecord.epoch |= static_cast<uint32_t>(record[5 + i]) << (8 * i);
+  }
+}
+
+bool gbj_apphelpers::checkReboot(const uint8_t *record)
+{
+  return record[1] != 0xFF &&
+         record[REBOOT_RECORD_SIZE - 1] == rebootChecksum(record);
+}
+
+void gbj_apphelpers::packCounter(uint8_t *counter, uint16_t value)
+{
+  counter[0] = value;
+  counter[1] = value >> 8;
+  counter[2] = ~(counter[0] + counter[1]);
+}
+
+bool gbj_apphelpers::checkCounter(const uint8_t *counter)
+{
+  return counter[2] == static_cast<uint8_t>(~(counter[0] + counter[1]));
+}
+
+const char gbj_apphelpers::DIGIT_PAIRS[] PROGMEM =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+char *gbj_apphelpers::formatNumber(char *buffer, uint32_t number, uint8_t width)
+{
+  char *end = buffer + width;
+  char *p = end;
+  // 32-bit division is expensive on 8-bit MCUs, so use it only until the
+  // rest of the number fits 16 bits
+  while (width >= 2 && number > 0xFFFF)
+  {
+    p -= 2;
+    formatDigits(p, number % 100);
+    number /= 100;
+    width -= 2;
+  }
+  // Only the lowest digit is left for truncated numbers
+  uint16_t rest = number > 0xFFFF ? number % 10 : number;
+  while (width >= 2)
+  {
+    p -= 2;
+    formatDigits(p, rest % 100);
+    rest /= 100;
+    width -= 2;
+  }
+  if (width)
+  {
+    *--p = '0' + rest % 10;
+  }
+  return end;
+}
+
+size_t gbj_apphelpers::formatPeriod(char *buffer,
+                                    size_t bufferSize,
+                                    uint32_t totalSeconds,
+                                    char delimiter)
+{
+  uint8_t seconds = totalSeconds % 60;
+
+  uint32_t totalMinutes = totalSeconds / 60;
+  uint8_t minutes = totalMinutes % 60;
+
+  uint32_t totalHours = totalMinutes / 60;
+  uint8_t hours = totalHours % 24;
+
+  uint32_t days = totalHours / 24;
+
+  // Render into local buffer first in order to check the length at once
+  char text[FORMAT_TIMEPERIOD_LEN + 1];
+  char *p = text;
+  if (days > 0)
+  {
+    p = formatNumber(p, days);
+    *p++ = 'd';
+    if (delimiter)
+    {
+      *p++ = delimiter;
+    }
+  }
+  if (days > 0 || hours > 0)
+  {
+    p = formatNumber(p, hours);
+    *p++ = 'h';
+    if (delimiter)
+    {
+      *p++ = delimiter;
+    }
+  }
+  if (days > 0 || hours > 0 || minutes > 0)
+  {
+    p = formatNumber(p, minutes);
+    *p++ = 'm';
+    if (delimiter)
+    {
+      *p++ = delimiter;
+    }
+  }
+  p = formatNumber(p, seconds);
+  *p++ = 's';
+  size_t length = p - text;
+  if (length >= bufferSize)
+  {
+    return formatEmpty(buffer, bufferSize);
+  }
+  memcpy(buffer, text, length);
+  buffer[length] = '\0';
+  return length;
+}
+
+namespace
+{
+  // Bit flags of URL encoding modes keeping a character unescaped, indexed
+  // by the character code; all characters above 127 are escaped
+  const uint8_t urlencodeTable[256] PROGMEM = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 6, 6, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0,
+    0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 6,
+    0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 4, 0,
+  };
+  const char urlencodeHex[] = "0123456789ABCDEF";
+
+  inline bool urlencodeKeep(char c, gbj_apphelpers::UrlModes mode)
+  {
+    return pgm_read_byte(&urlencodeTable[static_cast<uint8_t>(c)]) &
+           (1 << mode);
+  }
+
+  // Value of a hexadecimal digit or -1 for other characters
+  inline int8_t urldecodeHex(char c)
+  {
+    if (c >= '0' && c <= '9')
+    {
+      return c - '0';
+    }
+    c |= 0x20; // Lower case
+    if (c >= 'a' && c <= 'f')
+    {
+      return c - 'a' + 10;
+    }
+    return -1;
+  }
+}
+
+class gbj_apphelpers::UrlSink
+{
+public:
+  explicit UrlSink(Print &sink)
+    : sink_(sink)
+    , len_(0)
+    , written_(0)
+    , processed_(0)
+    , escape_(0)
+    , code_(0)
+    , malformed_(0)
+    , timestamp_(millis())
+  {
+  }
+
+  inline void put(char c)
+  {
+    chunk_[len_++] = c;
+    if (len_ >= URL_CHUNK_LEN)
+    {
+      flush();
+    }
+  }
+
+  inline void encode(char c, UrlModes mode)
+  {
+    if (urlencodeKeep(c, mode))
+    {
+      put(c);
+    }
+    else if (c == ' ' && mode != URLMODE_RFC3986)
+    {
+      put('+');
     }
     else
     {
-      code1 = (c & 0xf) + '0';
-      if ((c & 0xf) > 9)
+      put('%');
+      put(urlencodeHex[static_cast<uint8_t>(c) >> 4]);
+      put(urlencodeHex[c & 0xf]);
+    }
+  }
+
+  void encode(const char *str, size_t strLen, UrlModes mode)
+  {
+    while (strLen)
+    {
+      // Copy the run of unescaped characters at once
+      size_t run = 0;
+      while (run < strLen && urlencodeKeep(str[run], mode))
       {
-        code1 = (c & 0xf) - 10 + 'A';
+        run++;
       }
-      c = (c >> 4) & 0xf;
-      code0 = c + '0';
-      if (c > 9)
+      strLen -= run;
+      while (run)
       {
-        code0 = c - 10 + 'A';
+        size_t room = URL_CHUNK_LEN - len_;
+        size_t part = run < room ? run : room;
+        memcpy(&chunk_[len_], str, part);
+        len_ += part;
+        str += part;
+        run -= part;
+        if (len_ >= URL_CHUNK_LEN)
+        {
+          flush();
+        }
+      }
+      if (strLen)
+      {
+        encode(*str++, mode);
+        strLen--;
       }
-      // code2 = '\0';
+    }
+  }
+
+  inline void decode(char c)
+  {
+    switch (escape_)
+    {
+      case 1:
+        if (urldecodeHex(c) < 0)
+        {
+          // Malformed escape is kept and the character decoded again
+          unescape();
+          decode(c);
+          break;
+        }
+        code_ = c;
+        escape_ = 2;
+        break;
+
+      case 2:
+        if (urldecodeHex(c) < 0)
+        {
+          unescape();
+          decode(c);
+          break;
+        }
+        put((urldecodeHex(code_) << 4) | urldecodeHex(c));
+        escape_ = 0;
+        break;
+
+      default:
+        if (c == '%')
+        {
+          escape_ = 1;
+        }
+        else
+        {
+          put(c == '+' ? ' ' : c);
+        }
+        break;
+    }
+  }
+
+  // Keep an escape sequence truncated at the end of input
+  size_t flushDecode(size_t *malformed)
+  {
+    if (escape_)
+    {
+      unescape();
+    }
+    if (malformed)
+    {
+      *malformed = malformed_;
+    }
+    return flush();
+  }
+
+  size_t flush()
+  {
+    written_ += sink_.write(reinterpret_cast<const uint8_t *>(chunk_), len_);
+    processed_ += len_;
+    len_ = 0;
+    if (processed_ >= URL_YIELD_LEN || millis() - timestamp_ >= URL_YIELD_MS)
+    {
+      yield();
+      processed_ = 0;
+      timestamp_ = millis();
+    }
+    return written_;
+  }
+
+private:
+  Print &sink_;
+  char chunk_[URL_CHUNK_LEN];
+  uint8_t len_;
+  size_t written_;
+  size_t processed_;
+  uint8_t escape_;
+  char code_;
+  size_t malformed_;
+  unsigned long timestamp_;
+
+  // Write characters of a malformed escape sequence unchanged
+  void unescape()
+  {
+    put('%');
+    if (escape_ == 2)
+    {
+      put(code_);
+    }
+    escape_ = 0;
+    malformed_++;
+  }
+};
+
+String gbj_apphelpers::urlencode(const String &str, UrlModes mode)
+{
+  String encodedString = "";
+  encodedString.reserve(urlencodeLength(str.c_str(), str.length(), mode));
+  char c;
+  for (word i = 0; i < str.length(); i++)
+  {
+    c = str.charAt(i);
+    if (urlencodeKeep(c, mode))
+    {
+      encodedString += c;
+    }
+    else if (c == ' ' && mode != URLMODE_RFC3986)
+    {
+      encodedString += '+';
+    }
+    else
+    {
       encodedString += '%';
-      encodedString += code0;
-      encodedString += code1;
-      // encodedString+=code2;
+      encodedString += urlencodeHex[static_cast<uint8_t>(c) >> 4];
+      encodedString += urlencodeHex[c & 0xf];
     }
     yield();
   }
   return encodedString;
 }
 
-String gbj_apphelpers::urldecode(String str)
+size_t gbj_apphelpers::urlencode(Print &sink,
+                                 const char *str,
+                                 size_t strLen,
+                                 UrlModes mode)
+{
+  UrlSink urlSink(sink);
+  urlSink.encode(str, strLen, mode);
+  return urlSink.flush();
+}
+
+size_t gbj_apphelpers::urlencode(Print &sink, Stream &source, UrlModes mode)
+{
+  UrlSink urlSink(sink);
+  int c;
+  while ((c = source.read()) >= 0)
+  {
+    urlSink.encode(c, mode);
+  }
+  return urlSink.flush();
+}
+
+size_t gbj_apphelpers::urlencodeLength(const char *str,
+                                       size_t strLen,
+                                       UrlModes mode)
+{
+  size_t length = strLen;
+  bool plus = mode != URLMODE_RFC3986;
+  while (strLen--)
+  {
+    char c = *str++;
+    if (!urlencodeKeep(c, mode) && !(plus && c == ' '))
+    {
+      length += 2;
+    }
+  }
+  return length;
+}
+
+String gbj_apphelpers::urldecode(const String &str)
 {
   String encodedString = "";
   char c;
@@ -156,3 +1257,163 @@ String gbj_apphelpers::urldecode(String str)
   }
   return encodedString;
 }
+
+size_t gbj_apphelpers::urldecode(Print &sink,
+                                 const char *str,
+                                 size_t strLen,
+                                 size_t *malformed)
+{
+  UrlSink urlSink(sink);
+  while (strLen--)
+  {
+    urlSink.decode(*str++);
+  }
+  return urlSink.flushDecode(malformed);
+}
+
+size_t gbj_apphelpers::urldecode(Print &sink,
+                                 Stream &source,
+                                 size_t *malformed)
+{
+  UrlSink urlSink(sink);
+  int c;
+  while ((c = source.read()) >= 0)
+  {
+    urlSink.decode(c);
+  }
+  return urlSink.flushDecode(malformed);
+}
+
+size_t gbj_apphelpers::urldecode(char *buffer,
+                                 size_t bufferLen,
+                                 size_t *malformed)
+{
+  size_t errors = 0;
+  size_t w = 0;
+  for (size_t r = 0; r < bufferLen; r++)
+  {
+    char c = buffer[r];
+    if (c == '+')
+    {
+      c = ' ';
+    }
+    else if (c == '%')
+    {
+      int8_t hi = r + 2 < bufferLen ? urldecodeHex(buffer[r + 1]) : -1;
+      int8_t lo = hi < 0 ? -1 : urldecodeHex(buffer[r + 2]);
+      if (lo < 0)
+      {
+        errors++;
+      }
+      else
+      {
+        c = (hi << 4) | lo;
+        r += 2;
+      }
+    }
+    buffer[w++] = c;
+  }
+  if (w < bufferLen)
+  {
+    buffer[w] = '\0';
+  }
+  if (malformed)
+  {
+    *malformed = errors;
+  }
+  return w;
+}
+
+#if defined(__SSE2__) || defined(__ARM_NEON)
+size_t gbj_apphelpers::rangeKernel(const float *dataIn,
+                                   float *dataOut,
+                                   size_t dataLen,
+                                   float valDft,
+                                   float valMin,
+                                   float valMax,
+                                   uint8_t *invalidMask)
+{
+  size_t count = 0;
+  size_t i = 0;
+  #if defined(__SSE2__)
+  const __m128 vMin = _mm_set1_ps(valMin);
+  const __m128 vMax = _mm_set1_ps(valMax);
+  const __m128 vDft = _mm_set1_ps(valDft);
+  // Invalid flags are all ones, i.e., -1, so that subtracting counts them
+  __m128i vCount = _mm_setzero_si128();
+  for (; i + 8 <= dataLen; i += 8)
+  {
+    __m128 lo = _mm_loadu_ps(dataIn + i);
+    __m128 hi = _mm_loadu_ps(dataIn + i + 4);
+    __m128 invLo =
+      _mm_or_ps(_mm_cmplt_ps(lo, vMin), _mm_cmpgt_ps(lo, vMax));
+    __m128 invHi =
+      _mm_or_ps(_mm_cmplt_ps(hi, vMin), _mm_cmpgt_ps(hi, vMax));
+    if (dataOut)
+    {
+      _mm_storeu_ps(dataOut + i,
+                    _mm_or_ps(_mm_and_ps(invLo, vDft),
+                              _mm_andnot_ps(invLo, lo)));
+      _mm_storeu_ps(dataOut + i + 4,
+                    _mm_or_ps(_mm_and_ps(invHi, vDft),
+                              _mm_andnot_ps(invHi, hi)));
+    }
+    if (invalidMask)
+    {
+      invalidMask[i / 8] =
+        _mm_movemask_ps(invLo) | (_mm_movemask_ps(invHi) << 4);
+    }
+    vCount = _mm_sub_epi32(vCount, _mm_castps_si128(invLo));
+    vCount = _mm_sub_epi32(vCount, _mm_castps_si128(invHi));
+  }
+  uint32_t lanes[4];
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), vCount);
+  count = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+  #elif defined(__ARM_NEON)
+  const float32x4_t vMin = vdupq_n_f32(valMin);
+  const float32x4_t vMax = vdupq_n_f32(valMax);
+  const float32x4_t vDft = vdupq_n_f32(valDft);
+  const uint32_t weightsLo[4] = { 1, 2, 4, 8 };
+  const uint32_t weightsHi[4] = { 16, 32, 64, 128 };
+  const uint32x4_t vWeightsLo = vld1q_u32(weightsLo);
+  const uint32x4_t vWeightsHi = vld1q_u32(weightsHi);
+  // Invalid flags are all ones, i.e., -1, so that subtracting counts them
+  uint32x4_t vCount = vdupq_n_u32(0);
+  for (; i + 8 <= dataLen; i += 8)
+  {
+    float32x4_t lo = vld1q_f32(dataIn + i);
+    float32x4_t hi = vld1q_f32(dataIn + i + 4);
+    uint32x4_t invLo = vorrq_u32(vcltq_f32(lo, vMin), vcgtq_f32(lo, vMax));
+    uint32x4_t invHi = vorrq_u32(vcltq_f32(hi, vMin), vcgtq_f32(hi, vMax));
+    if (dataOut)
+    {
+      vst1q_f32(dataOut + i, vbslq_f32(invLo, vDft, lo));
+      vst1q_f32(dataOut + i + 4, vbslq_f32(invHi, vDft, hi));
+    }
+    if (invalidMask)
+    {
+      // Horizontal sum of weighted flags forms the bitmask byte
+      uint32x4_t weighted = vorrq_u32(vandq_u32(invLo, vWeightsLo),
+                                      vandq_u32(invHi, vWeightsHi));
+      uint32x2_t sum =
+        vpadd_u32(vget_low_u32(weighted), vget_high_u32(weighted));
+      sum = vpadd_u32(sum, sum);
+      invalidMask[i / 8] = vget_lane_u32(sum, 0);
+    }
+    vCount = vsubq_u32(vCount, invLo);
+    vCount = vsubq_u32(vCount, invHi);
+  }
+  uint32x2_t total = vpadd_u32(vget_low_u32(vCount), vget_high_u32(vCount));
+  total = vpadd_u32(total, total);
+  count = vget_lane_u32(total, 0);
+  #endif
+  // Remaining items by generic kernel
+  return count + rangeKernel<float>(dataIn + i,
+                                    dataOut ? dataOut + i : NULL,
+                                    dataLen - i,
+                                    valDft,
+                                    valMin,
+                                    valMax,
+                                    invalidMask ? invalidMask + i / 8 : NULL);
+}
+#endif
@@ -41,6 +41,174 @@ public:
     uint8_t weekday = 1;
     bool mode12h = false;
     bool pm = false;
+
+    Datetime() = default;
+    // Enables compile time constants of datetime records
+    constexpr Datetime(uint16_t y,
+                       uint8_t mo,
+                       uint8_t d,
+                       uint8_t h,
+                       uint8_t mi,
+                       uint8_t s,
+                       uint8_t wd,
+                       bool h12 = false,
+                       bool p = false)
+      : year(y)
+      , month(mo)
+      , day(d)
+      , hour(h)
+      , minute(mi)
+      , second(s)
+      , weekday(wd)
+      , mode12h(h12)
+      , pm(p)
+    {
+    }
+  };
+
+  using Psychrometrics = struct Psychrometrics
+  {
+    float dewpoint = -999.0;
+    float heatIndex = -999.0;
+    float absoluteHumidity = -999.0;
+    float humidex = -999.0;
+  };
+
+  /*
+    Units of physical quantities.
+
+    DESCRIPTION:
+    A unit is a type defined by its dimension and affine transformation of its
+    values to the base unit of the dimension by rational constants, i.e.,
+    base = value * ScaleNum / ScaleDen + OffsetNum / OffsetDen.
+    - Base units are kelvin, pascal, meter, and second.
+    - Custom units can be defined by the template Unit in the same way.
+  */
+  struct DimTemperature
+  {
+  };
+  struct DimPressure
+  {
+  };
+  struct DimLength
+  {
+  };
+  struct DimTime
+  {
+  };
+  template<class Dim,
+           int64_t ScaleNum,
+           int64_t ScaleDen = 1,
+           int64_t OffsetNum = 0,
+           int64_t OffsetDen = 1>
+  struct Unit
+  {
+    using Dimension = Dim;
+    static constexpr int64_t SCALE_NUM = ScaleNum;
+    static constexpr int64_t SCALE_DEN = ScaleDen;
+    static constexpr int64_t OFFSET_NUM = OffsetNum;
+    static constexpr int64_t OFFSET_DEN = OffsetDen;
+  };
+  using UnitKelvin = Unit<DimTemperature, 1>;
+  using UnitCelsius = Unit<DimTemperature, 1, 1, 27315, 100>;
+  using UnitFahrenheit = Unit<DimTemperature, 5, 9, 45967, 180>;
+  using UnitPascal = Unit<DimPressure, 1>;
+  using UnitHectoPascal = Unit<DimPressure, 100>;
+  using UnitInchMercury = Unit<DimPressure, 3386389, 1000>;
+  using UnitMillimeterMercury = Unit<DimPressure, 26664477483LL, 200000000>;
+  using UnitMeter = Unit<DimLength, 1>;
+  using UnitFoot = Unit<DimLength, 381, 1250>;
+  using UnitSecond = Unit<DimTime, 1>;
+  using UnitMillisecond = Unit<DimTime, 1, 1000>;
+
+  /*
+    Convert a value between units.
+
+    DESCRIPTION:
+    The method converts a value expressed in one unit to another unit of the
+    same dimension.
+    - Constants of the whole conversion chain through the base unit are
+      combined at compile time, so that the conversion is a single
+      multiplication and addition.
+    - Floating point values are converted by the combined factor and shift.
+    - Integer values are converted by rational arithmetic and rounded to
+      the nearest integer. Pure multiplication or division by an integer
+      is done in the data type of the value, other conversions in 64 bits.
+      The data type should have at least 16 bits.
+    - Conversion between units of different dimensions is a compile error.
+
+    PARAMETERS:
+    From, To - Template parameters with source and target unit.
+    value - Value in the source unit.
+      - Data type: arithmetic
+      - Default value: none
+      - Limited range: the product of the value and the combined numerator
+        within 64 bits for integer values
+
+    RETURN:
+    Value in the target unit.
+  */
+  template<class From, class To, class T>
+  static constexpr T convertUnit(T value)
+  {
+    static_assert(
+      SameType<typename From::Dimension, typename To::Dimension>::VALUE,
+      "Conversion between units of different dimensions");
+    return UnitKernel<(T(1) / T(2) == T(0))>::template convert<
+      T,
+      UnitConversion<From, To>>(value);
+  }
+
+  /*
+    Value of a physical quantity with its unit.
+
+    DESCRIPTION:
+    The class template binds a value to its unit at compile time without any
+    runtime overhead, i.e., the object has the size of the value.
+    - An object converts implicitly to a quantity of another unit with the
+      same dimension by the method convertUnit. Conversion to a unit of
+      another dimension is a compile error.
+    - All methods are constexpr, so that conversions of constant quantities
+      are evaluated at compile time.
+
+    PARAMETERS:
+    U - Template parameter with the unit of the quantity.
+    T - Template parameter with the data type of the value, float by default.
+
+    USAGE:
+    Quantity<UnitCelsius> temp(25.0);
+    Quantity<UnitFahrenheit> tempF = temp;
+    float value = temp.to<UnitKelvin>().value();
+  */
+  template<class U, class T = float>
+  class Quantity
+  {
+  public:
+    using UnitType = U;
+    using ValueType = T;
+
+    constexpr Quantity()
+      : value_()
+    {
+    }
+    explicit constexpr Quantity(T value)
+      : value_(value)
+    {
+    }
+    template<class V>
+    constexpr Quantity(const Quantity<V, T> &other)
+      : value_(convertUnit<V, U>(other.value()))
+    {
+    }
+    constexpr T value() const { return value_; }
+    template<class V>
+    constexpr Quantity<V, T> to() const
+    {
+      return Quantity<V, T>(*this);
+    }
+
+  private:
+    T value_;
   };
 
   // MCU internal reboot sources
@@ -53,6 +221,56 @@ public:
     MCUREBOOT_GSHEET,
     MCUREBOOT_THERMO,
     MCUREBOOT_THINGSPEAK,
+    // The first code of reboot sources registered by an application
+    MCUREBOOT_USER = 16,
+  };
+
+  // Sizes of serialized reboot statistics in bytes
+  enum RebootSizes : uint8_t
+  {
+    // Identification and dimensions
+    REBOOT_HEADER_SIZE = 4,
+    // Counter of a reboot source with its check
+    REBOOT_COUNTER_SIZE = 3,
+    // Sequence, reason, uptime, epoch, count of the reason, checksum
+    REBOOT_RECORD_SIZE = 12,
+  };
+
+  // Maximal lengths of formatted strings without terminating null character
+  enum FormatLengths : uint8_t
+  {
+    // 23:59:59
+    FORMAT_TIMEDAY_LEN = 8,
+    // 49710d 23h 59m 59s
+    FORMAT_TIMEPERIOD_LEN = 18,
+    // 49710d23h59m59s
+    FORMAT_TIMEPERIODDENSE_LEN = 15,
+    // 31.12.2106 23:59:59
+    FORMAT_EPOCHSECONDS_LEN = 19,
+    // Textual name of reboot source registered by an application
+    FORMAT_REBOOTTEXT_LEN = 23,
+  };
+
+  // Sets of characters kept by URL encoding, all other ones are escaped
+  enum UrlModes : byte
+  {
+    // Alphanumeric characters only, space as '+'
+    URLMODE_ALNUM,
+    // Alphanumeric characters and "*-._", space as '+' (HTML forms)
+    URLMODE_FORM,
+    // Unreserved characters of RFC 3986, alphanumeric ones and "-._~"
+    URLMODE_RFC3986,
+  };
+
+  // Results of parsing datetime strings
+  enum ParseResults : byte
+  {
+    // Successfully parsed
+    PARSE_SUCCESS,
+    // Unexpected character or missing part
+    PARSE_ERROR_FORMAT,
+    // Part of datetime out of range or datetime out of epoch time range
+    PARSE_ERROR_RANGE,
   };
 
   /*
@@ -79,693 +297,3962 @@ public:
   static float calculateDewpoint(float rhum, float temp);
 
   /*
-    Count digits in an non-negative integer number.
+    Calculate dew point temperatures for arrays of measurements.
 
     DESCRIPTION:
-    The method determines count of digits in an integer number
-    in decimal notation.
-    - Also zero is counted as 1 digit.
+    The method calculates dew point temperature for each pair of items of
+    provided buffers with relative humidity and temperature and writes them
+    to the output buffer.
+    - The method uses branchless kernel with own polynomial logarithm, so that
+      compilers can vectorize it. Results differ from the scalar method
+      within 0.001 centigrade.
+    - The output buffer can be the same as one of the input buffers.
 
     PARAMETERS:
-    val - Counted integer.
+    rhum - Buffer with ambient relative humidities in per cents.
+    temp - Buffer with ambient temperatures in centigrades.
+    dewpoint - Output buffer for temperatures of dew point in centigrades or
+      unreasonable value -999.0.
+      - Data type: float pointer
+      - Default value: none
+      - Limited range: address space
+
+    dataLen - Number of the first data items in the buffers to calculate.
       - Data type: non-negative integer
       - Default value: none
-      - Limited range: 0 ~ 2^32 - 1
+      - Limited range: 0 ~ size_t
 
     RETURN:
-    Number of digits of an integer in decimal notation.
+    Number of unreasonable dew points.
   */
-  static inline uint8_t calculateDigits(uint32_t number)
-  {
-    uint8_t digits = 0;
-    do
-    {
-      number /= 10;
-      digits++;
-    } while (number);
-    return digits;
-  }
+  static size_t calculateDewpointArray(const float *rhum,
+                                       const float *temp,
+                                       float *dewpoint,
+                                       size_t dataLen);
 
   /*
-    Convert temperature between Celsius and Fahrenheit.
+    Calculate dew point temperature in fixed point arithmetic.
 
     DESCRIPTION:
-    The particular method calculates temperature expressed in one temperature
-    scale to another one as indicates its name.
+    The method is an integer variant of the method calculateDewpoint for
+    microcontrollers without FPU.
+    - The logarithm is approximated by linear interpolation in the table of
+      binary logarithms, divisions are 32-bit long ones.
+    - The result is accurate within 0.02 centigrade against the method
+      with floating point arithmetic.
 
     PARAMETERS:
-    temp - Temperature value.
-      - Data type: float
+    rhum - Ambient relative humidity in deci-percent, e.g., 553 for 55.3 %.
+      - Data type: non-negative integer
       - Default value: none
-      - Limited range: system determined
+      - Limited range: 1 ~ 65535
 
-    RETURN: None
+    temp - Ambient temperature in centi-degrees of centigrade, e.g., 2530 for
+      25.30 centigrade.
+      - Data type: integer
+      - Default value: none
+      - Limited range: -22869 ~ 16753649
+
+    RETURN:
+    Temperature of dew point in centi-degrees of centigrade or unreasonable
+    value -99900.
   */
-  static inline float convertCelsius2Fahrenheit(float temp)
-  {
-    return (temp * 9.0 / 5.0) + 32.0;
-  };
-  static inline float convertFahrenheit2Celsius(float temp)
-  {
-    return (temp - 32.0) * 5.0 / 9.0;
-  };
+  static int32_t calculateDewpointFixed(uint16_t rhum, int32_t temp);
 
   /*
-    Convert milliseconds to seconds with rounding.
+    Calculate psychrometric quantities of air.
 
     DESCRIPTION:
-    The method calculates seconds from provided milliseconds and round seconds
-    to integer mathematically.
+    The fused method calculates dew point, heat index, absolute humidity, and
+    humidex from provided temperature and relative humidity at once.
+    - The logarithmic term of the dew point determines partial pressure of
+      water vapour as well, so that the fused method computes just one
+      logarithm and one power for all quantities. The dew point is the same
+      as from the method calculateDewpoint.
+    - The particular methods calculate just the quantity as indicates their
+      names. Each of them computes the shared terms on its own.
+    - Absolute humidity is in grams of water vapour per cubic meter of air.
+    - Heat index is calculated by NOAA algorithm with Rothfusz regression
+      and its adjustments. It is expressed in centigrades.
+    - Humidex is calculated by Environment Canada formula.
 
     PARAMETERS:
-    ms - Milliseconds to be converted.
-      - Data type: unsigned long integer
+    rhum - Ambient relative humidity in per cents.
+      - Data type: float
       - Default value: none
-      - Limited range: 0 ~ (2^32 - 1)
+      - Limited range: > 0.0
+
+    temp - Ambient temperature in centigrades.
+      - Data type: float
+      - Default value: none
+      - Limited range: > -273.15
 
     RETURN:
-    Seconds rounded to integer mathematically.
+    Structure with all quantities or the quantity, each of them with
+    unreasonable value -999.0 for invalid input.
   */
-  static inline uint32_t convertMs2Sec(uint32_t ms)
-  {
-    return (ms + 500) / 1000;
-  }
+  static Psychrometrics calculatePsychrometrics(float rhum, float temp);
+  static float calculateHeatIndex(float rhum, float temp);
+  static float calculateAbsoluteHumidity(float rhum, float temp);
+  static float calculateHumidex(float rhum, float temp);
 
   /*
-    Software button debouncing.
+    Calculate altitude from barometric pressures.
 
     DESCRIPTION:
-    The method reads a GPIO pin until the read value is same as input value.
+    The method calculates local altitude from provided local barometric pressure
+    and corresponding sea level pressure.
+    - Both input pressures should be in the same measurement unit. However that
+    unit can be arbitrary, usually Pascal or hectoPascal.
 
     PARAMETERS:
-    iniVal - Initially read button state.
-      - Data type: uint8_t
-      - Default value: none
-      - Limited range: 0 ~ 255
+    pressure - Local barometric pressure in arbitrary measurement unit, usually
+    Pascal or hectoPascal.
+    - Data type: decimal
+    - Default value: none
+    - Limited range: none
 
-    pin - GPIO number of a microcontroller with connected button.
-      - Data type: uint8_t
-      - Default value: none
-      - Limited range: 0 ~ 255
+    pressureSea - Sea level barometric pressure in arbitrary measurement unit,
+    but the same as the first argument has.
+    - Data type: decimal
+    - Default value: none
+    - Limited range: none
 
     RETURN:
-    Stabile input value of the pin.
+    Altitude in meters.
   */
-  static inline uint8_t debounce(uint8_t iniVal, uint8_t pin)
+  static inline float calculateAltitudeFromPressures(float pressure,
+                                                     float pressureSea)
   {
-    uint8_t curVal = digitalRead(pin);
-    if (iniVal != curVal)
-    {
-      delay(5);
-      curVal = digitalRead(pin);
-    }
-    return curVal;
+    return 44330.0 * (1.0 - pow(pressure / pressureSea, (1.0 / 5.255)));
   }
 
   /*
-    Convert microcontroller code to textual name.
+    Calculate sea level barometric pressures.
 
     DESCRIPTION:
-    Provided MCU internal reboot code is translated to a textual representation.
+    The method calculates barometric pressure at sea level from provided local
+    pressure and altitude.
+    - The measurement unit of the local pressure can be arbitrary. However the
+    methods returns the sea level pressure in the same unit.
 
     PARAMETERS:
-    code - Microcontroller internal reboot source
-    - Data type: McuReboots
+    pressure - Local barometric pressure in arbitrary measurement unit, usually
+    Pascal or hectoPascal.
+    - Data type: decimal
+    - Default value: none
+    - Limited range: none
+
+    altitude - Local altitude in meters for which the equivalent sea level
+    pressure should be calculated.
+    - Data type: decimal
     - Default value: none
     - Limited range: none
 
     RETURN:
-    Textual representation of the MCU reboot source.
+    Barometric pressure at sea level.
   */
-  static inline String convertReboot2Text(McuReboots code)
+  static inline float calculatePressureSeaFromAltitude(float pressure,
+                                                       float altitude)
   {
-    String result;
-    switch (code)
-    {
-      case McuReboots::MCUREBOOT_ERRORS:
-        result = F("Permanent Error(s)");
-        break;
-
-      case McuReboots::MCUREBOOT_WIFI:
-        result = F("Wifi");
-        break;
-
-      case McuReboots::MCUREBOOT_WEB:
-        result = F("WebServer");
-        break;
-
-      case McuReboots::MCUREBOOT_GSHEET:
-        result = F("GoogleSpredsheets");
-        break;
+    return pressure / pow(1.0 - altitude / 44330.0, 5.255);
+  }
 
-      case McuReboots::MCUREBOOT_THERMO:
-        result = F("Thermometer");
-        break;
+  /*
+    Calculate altitude or sea level pressure from quantities with units.
 
-      case McuReboots::MCUREBOOT_THINGSPEAK:
-        result = F("Thingspeak");
-        break;
+    DESCRIPTION:
+    The particular method is a variant of the corresponding method with
+    floating point arithmetic for quantities with compile time units.
+    - Pressures can be in different units, the sea level pressure is
+      converted to the unit of the local pressure.
+    - Altitude can be in any length unit, the altitude is returned in meters.
+    - Quantities of other dimensions are compile errors.
 
-      default:
-        result = F("Unknown");
-        break;
-    }
-    return result;
-  };
+    RETURN:
+    Altitude in meters or sea level pressure in the unit of local pressure.
+  */
+  template<class U, class V, class T>
+  static inline Quantity<UnitMeter, T> calculateAltitudeFromPressures(
+    const Quantity<U, T> &pressure,
+    const Quantity<V, T> &pressureSea)
+  {
+    static_assert(SameType<typename U::Dimension, DimPressure>::VALUE,
+                  "Pressure quantity expected");
+    return Quantity<UnitMeter, T>(calculateAltitudeFromPressures(
+      pressure.value(), Quantity<U, T>(pressureSea).value()));
+  }
+  template<class U, class L, class T>
+  static inline Quantity<U, T> calculatePressureSeaFromAltitude(
+    const Quantity<U, T> &pressure,
+    const Quantity<L, T> &altitude)
+  {
+    static_assert(SameType<typename U::Dimension, DimPressure>::VALUE,
+                  "Pressure quantity expected");
+    return Quantity<U, T>(calculatePressureSeaFromAltitude(
+      pressure.value(), Quantity<UnitMeter, T>(altitude).value()));
+  }
 
   /*
-    Parse compiler day and time format to datetime record.
+    Calculate altitude or sea level pressure in fixed point arithmetic.
 
     DESCRIPTION:
-    The method extracts corresponding parts of a day as well as time
-    structure from strings formatted as a compiler __DATE__ and __TIME__
-    system constants, e.g., "Dec 26 2018" and "12:34:56".
-    - The method is overloaded, either for flashed constants or for generic
-      strings in SRAM.
+    The particular method is an integer variant of the corresponding method
+    with floating point arithmetic for microcontrollers without FPU.
+    - Pressures are in pascals, altitude is in centimeters.
+    - The power function is approximated by a minimax polynomial evaluated
+      in 64-bit integers.
+    - The altitude method is accurate within 3 cm for the ratio of pressures
+      0.3 ~ 1.1, i.e., altitudes -770 ~ 9160 m. Altitudes out of that range
+      are limited to the range boundaries.
+    - The sea level pressure method is accurate within 1 Pa for altitudes
+      -880 ~ 8860 m, which limit altitudes out of that range.
 
     PARAMETERS:
-    dtRecord - Referenced structure variable for desired day and time.
-      - Data type: gbj_apphelpers::Datetime
+    pressure - Local barometric pressure in pascals.
+      - Data type: non-negative integer
       - Default value: none
-      - Limited range: address space
+      - Limited range: 0 ~ 16777215
 
-    strDate - Pointer to a system day formatted string.
-      - Data type: char pointer
+    pressureSea - Sea level barometric pressure in pascals.
+      - Data type: non-negative integer
       - Default value: none
-      - Limited range: address range
+      - Limited range: 1 ~ 16777215
 
-    strTime - Pointer to a system time formatted string.
-      - Data type: char pointer
+    altitude - Local altitude in centimeters.
+      - Data type: integer
       - Default value: none
-      - Limited range: address range
+      - Limited range: -88660 ~ 886600
 
-    RETURN: none
+    RETURN:
+    Altitude in centimeters or barometric pressure at sea level in pascals.
   */
-  static void parseDateTime(Datetime &dtRecord,
-                            const char *strDate,
-                            const char *strTime);
-  static void parseDateTime(Datetime &dtRecord,
-                            const __FlashStringHelper *strDate,
-                            const __FlashStringHelper *strTime);
+  static int32_t calculateAltitudeFromPressuresFixed(uint32_t pressure,
+                                                     uint32_t pressureSea);
+  static uint32_t calculatePressureSeaFromAltitudeFixed(uint32_t pressure,
+                                                        int32_t altitude);
 
   /*
-    Check value for valid range.
+    Count digits in an integer number.
 
     DESCRIPTION:
-    The method tests input value for valid range defined by minimum and
-    maximum value.
-    - Values can of any comparable data type, but all of the same one.
+    The method determines count of digits in an integer number
+    in decimal notation in constant time by comparing the number with powers
+    of ten without any division.
+    - Also zero is counted as 1 digit.
+    - The method is constexpr, so that it can determine buffer sizes at
+      compile time.
+    - The template variant accepts integers of all widths and signedness.
+      The sign of a negative number is not counted.
+    - The non-template variant for 32-bit unsigned integers accepts other
+      arithmetic types, e.g., floating point numbers, by implicit conversion.
 
     PARAMETERS:
-    valCur - Checked value.
-    valMin, valMax - Values determining a valid range.
+    number - Counted integer.
+      - Data type: integer
+      - Default value: none
+      - Limited range: system determined
 
     RETURN:
-    Boolean flag of validity.
+    Number of digits of an integer in decimal notation.
   */
-  template<class T>
-  static inline bool check(T valCur, T valMin, T valMax)
+  static constexpr uint8_t calculateDigits(uint32_t number)
   {
-    if (valCur < valMin || valCur > valMax)
-    {
-      return false;
-    }
-    return true;
+    return digitsCount32(number);
+  }
+  template<class T, class = decltype(T() % 2)>
+  static constexpr uint8_t calculateDigits(T number)
+  {
+    // Negative number without warning on comparing unsigned one with zero
+    return (number < 1 && number != 0)
+             ? (sizeof(T) > 4
+                  ? digitsCount64(0 - static_cast<uint64_t>(number))
+                  : digitsCount32(0 - static_cast<uint32_t>(number)))
+             : (sizeof(T) > 4 ? digitsCount64(static_cast<uint64_t>(number))
+                              : digitsCount32(static_cast<uint32_t>(number)));
   }
 
   /*
-    Sanitize value for valid range and default value.
+    Convert temperature between Celsius and Fahrenheit.
 
     DESCRIPTION:
-    The method tests input value for valid range defined by minimum and
-    maximum value. If it is outside of the range, method replaces input value
-    with default value.
-    - Values can of any comparable data type, but all of the same one.
+    The particular method calculates temperature expressed in one temperature
+    scale to another one as indicates its name.
 
     PARAMETERS:
-    valCur - Sanitized value.
-    valDft - Default value.
-    valMin, valMax - Values determining a valid range.
+    temp - Temperature value.
+      - Data type: float
+      - Default value: none
+      - Limited range: system determined
 
-    RETURN:
-    Current of default value.
+    RETURN: None
   */
-  template<class T>
-  static inline T sanitize(T valCur, T valDft, T valMin, T valMax)
+  static inline float convertCelsius2Fahrenheit(float temp)
   {
-    if (!check(valCur, valMin, valMax))
-    {
-      valCur = valDft;
-    }
-    return valCur;
-  }
+    return (temp * 9.0 / 5.0) + 32.0;
+  };
+  static inline float convertFahrenheit2Celsius(float temp)
+  {
+    return (temp - 32.0) * 5.0 / 9.0;
+  };
 
   /*
-    Sort buffered values in ascending order.
+    Convert temperature between Celsius and Fahrenheit in fixed point
+    arithmetic.
 
     DESCRIPTION:
-    The method sorts data items in a provided referenced buffer with help of
-    buble sorting algorithm.
+    The particular method is an integer variant of the corresponding method
+    with floating point arithmetic for microcontrollers without FPU.
+    - Temperatures are in centi-degrees, e.g., 2530 for 25.30 degrees.
+    - The rational arithmetic rounds the result to the nearest centi-degree.
 
     PARAMETERS:
-    dataBuffer - Data buffer with data items of various data type.
-    dataLen - Number of the first data items in the buffer to sort.
-      - Data type: non-negative integer
+    temp - Temperature value in centi-degrees.
+      - Data type: integer
       - Default value: none
-      - Limited range: 0 ~ 65535
+      - Limited range: -238609294 ~ 238609294
 
-    RETURN: None
+    RETURN:
+    Temperature in centi-degrees of target temperature scale.
   */
-  template<class T>
-  static inline void sort_buble_asc(T *dataBuffer, uint16_t dataLen)
+  static inline int32_t convertCelsius2FahrenheitFixed(int32_t temp)
   {
-    bool again = true;
-    for (uint16_t i = 0; i < (dataLen - 1) && again; i++)
-    {
-      again = false;
-      for (uint16_t j = dataLen - 1; j > i; --j)
-      {
-        // Next item is lower than previous one
-        if (dataBuffer[j] < dataBuffer[j - 1])
-        {
-          swapdata(dataBuffer[j], dataBuffer[j - 1]);
-          again = true;
-        }
-      }
-    }
-  }
+    return divideRound(temp * 9, 5) + 3200;
+  };
+  static inline int32_t convertFahrenheit2CelsiusFixed(int32_t temp)
+  {
+    return divideRound((temp - 3200) * 5, 9);
+  };
 
   /*
-    Sort buffered values in descending order.
+    Convert arrays of temperatures between Celsius and Fahrenheit.
 
     DESCRIPTION:
-    The method sorts the first number of data items in a provided buffer
-    with help of buble sorting algorithm.
+    The particular method converts temperatures in a buffer expressed in one
+    temperature scale to another one as indicates its name and writes them to
+    the output buffer, which can be the same as the input one.
+    - The method is written so that compilers can vectorize it.
 
     PARAMETERS:
-    dataBuffer - Data buffer with data items of various data type.
-    dataLen - Number of the first data items in the buffer to sort.
+    tempIn - Buffer with temperature values.
+    tempOut - Output buffer for converted temperature values.
+      - Data type: float pointer
+      - Default value: none
+      - Limited range: address space
+
+    dataLen - Number of the first data items in the buffer to convert.
       - Data type: non-negative integer
       - Default value: none
-      - Limited range: 0 ~ 65535
+      - Limited range: 0 ~ size_t
 
     RETURN: None
   */
-  template<class T>
-  static inline void sort_buble_desc(T *dataBuffer, uint16_t dataLen)
-  {
-    bool again = true;
-    for (uint16_t i = 0; i < (dataLen - 1) && again; i++)
-    {
-      again = false;
-      for (uint16_t j = dataLen - 1; j > i; --j)
-      {
-        // Next item is greated than previous one
-        if (dataBuffer[j] > dataBuffer[j - 1])
-        {
-          swapdata(dataBuffer[j], dataBuffer[j - 1]);
-          again = true;
-        }
-      }
-    }
-  }
+  static void convertCelsius2FahrenheitArray(const float *tempIn,
+                                             float *tempOut,
+                                             size_t dataLen);
+  static void convertFahrenheit2CelsiusArray(const float *tempIn,
+                                             float *tempOut,
+                                             size_t dataLen);
 
   /*
-    Swap two data items.
+    Convert milliseconds to seconds with rounding.
 
     DESCRIPTION:
-    The method swappes input data items pair upside down.
+    The method calculates seconds from provided milliseconds and round seconds
+    to integer mathematically.
 
     PARAMETERS:
-    item1, item2 - Referenced data items to be swapped.
-      - Data type: various
+    ms - Milliseconds to be converted.
+      - Data type: unsigned long integer
+      - Default value: none
+      - Limited range: 0 ~ (2^32 - 1)
 
-    RETURN: none
+    RETURN:
+    Seconds rounded to integer mathematically.
   */
-  template<class T>
-  static inline void swapdata(T &item1, T &item2)
+  static inline uint32_t convertMs2Sec(uint32_t ms)
   {
-    T temp = item1;
-    item1 = item2;
-    item2 = temp;
+    return (ms + 500) / 1000;
   }
 
   /*
-    Format daily time in seconds.
+    Convert unix epoch time to datetime record.
 
     DESCRIPTION:
-    The method formats input seconds to string with hours, minutes,
-    and seconds all with leading zeros (??:??:??).
+    The method splits input seconds as a unix epoch time to calendar date,
+    time of a day, and day of a week in constant time without iterating
+    years and months.
+    - The year is stored as a full year, e.g., 2021.
+    - The time is stored in 24 hours mode, but the flag about past meridiem
+      is set as well.
+    - The day of a week is counted according to ISO 8601 from 1 for Monday
+      to 7 for Sunday.
 
     PARAMETERS:
-    totalSeconds - Seconds since midnight.
+    dtRecord - Referenced structure variable for resulting day and time.
+      - Data type: gbj_apphelpers::Datetime
+      - Default value: none
+      - Limited range: address space
+
+    epochSeconds - Seconds since 01.01.1970 00:00:00.
       - Data type: 32-bit integer
+      - Default value: none
+      - Limited range: 0 ~ (2^32 - 1)
 
-    RETURN:
-    String - formatted textual expression of a time within a day.
+    RETURN: none
   */
-  static inline String formatTimeDay(uint32_t totalSeconds)
-  {
-    char result[9];
-    uint8_t seconds = totalSeconds % 60;
+  static void convertEpoch2Datetime(Datetime &dtRecord,
+                                    unsigned long epochSeconds);
 
-    uint32_t totalMinutes = totalSeconds / 60;
-    uint8_t minutes = totalMinutes % 60;
+  /*
+    Convert datetime record to unix epoch time.
 
-    uint32_t totalHours = totalMinutes / 60;
-    uint8_t hours = totalHours % 24;
+    DESCRIPTION:
+    The method calculates seconds since 01.01.1970 00:00:00 from calendar date
+    and time of a day in a datetime record in constant time. It is the
+    inverse method to the method convertEpoch2Datetime.
+    - The year below 100 is considered as a two-digit year of 21st century,
+      as it is stored by parsing methods and real time clock chips.
+    - The time in 12 hours mode is taken into account.
+    - The day of a week in the record is ignored.
 
-    sprintf(result, "%02u:%02u:%02u", hours, minutes, seconds);
-    return result;
-  }
+    PARAMETERS:
+    dtRecord - Referenced structure variable with a day and time.
+      - Data type: gbj_apphelpers::Datetime
+      - Default value: none
+      - Limited range: 01.01.1970 00:00:00 ~ 07.02.2106 06:28:15
+
+    RETURN:
+    Unix epoch time in seconds or 0 for a datetime before the epoch.
+  */
+  static unsigned long convertDatetime2Epoch(const Datetime &dtRecord);
 
   /*
-    Format time period in seconds.
+    Software button debouncing.
 
     DESCRIPTION:
-    The method formats input seconds to string with days, hours, minutes,
-    and seconds ([[x]xd ][[x]xh ][[x]xm ][x]xs).
+    The method reads a GPIO pin until the read value is same as input value.
 
     PARAMETERS:
-    totalSeconds - Length of a time period in seconds.
-      - Data type: integer
+    iniVal - Initially read button state.
+      - Data type: uint8_t
+      - Default value: none
+      - Limited range: 0 ~ 255
+
+    pin - GPIO number of a microcontroller with connected button.
+      - Data type: uint8_t
+      - Default value: none
+      - Limited range: 0 ~ 255
 
     RETURN:
-    String - formatted textual expresion of a time period.
+    Stabile input value of the pin.
   */
-  static inline String formatTimePeriod(uint32_t totalSeconds)
+  static inline uint8_t debounce(uint8_t iniVal, uint8_t pin)
   {
-    uint8_t seconds = totalSeconds % 60;
+    uint8_t curVal = digitalRead(pin);
+    if (iniVal != curVal)
+    {
+      delay(5);
+      curVal = digitalRead(pin);
+    }
+    return curVal;
+  }
 
-    uint32_t totalMinutes = totalSeconds / 60;
-    uint8_t minutes = totalMinutes % 60;
+  /*
+    Non-blocking debouncer of multiple inputs.
 
-    uint32_t totalHours = totalMinutes / 60;
-    uint8_t hours = totalHours % 24;
+    DESCRIPTION:
+    The class template samples up to 32 digital inputs at regular period and
+    debounces all of them in parallel by vertical counters, i.e., a 2-bit
+    counter for each input is formed by corresponding bits of two bitmasks.
+    - An input changes its debounced state after 4 consecutive samples
+      different from that state, i.e., debouncing time is 4 periods.
+      A bounce resets the counter of the input.
+    - Inputs are represented by bits of bitmasks in order of provided pins.
+      Bit 1 of the debounced state means an active input.
+    - On AVR microcontrollers each port input register is read just once at
+      sampling, other platforms read each pin by digitalRead().
+    - Samples can be provided by the method tick() as well, e.g., from an
+      I/O expander.
+    - No delay is used, so that the loop is never stalled.
+
+    TEMPLATE PARAMETERS:
+    N - Number of inputs.
+      - Data type: non-negative integer
+      - Limited range: 1 ~ 32
 
-    uint32_t days = totalHours / 24;
+    USAGE:
+    const uint8_t pins[] = { 2, 3, 4 };
+    gbj_apphelpers::Debouncer<3> buttons(pins, 0b111);
+    buttons.begin();
+    if (buttons.update() && buttons.getPressed() & 0b001) {}
+  */
+  template<uint8_t N>
+  class Debouncer
+  {
+  public:
+    /*
+      Constructor.
+
+      PARAMETERS:
+      pins - Pointer to an array of N GPIO numbers of inputs. The array is not
+        copied, so that it should exist during the life of the object.
+        - Data type: uint8_t pointer
+        - Default value: none
+        - Limited range: address space
+
+      activeLow - Bitmask of inputs active at low level, e.g., buttons with
+        pull-up resistors.
+        - Data type: 32-bit bitmask
+        - Default value: 0
+        - Limited range: 0 ~ 2^N - 1
+
+      periodMs - Sampling period in milliseconds.
+        - Data type: non-negative integer
+        - Default value: 5
+        - Limited range: 0 ~ 255
+    */
+    Debouncer(const uint8_t *pins, uint32_t activeLow = 0, uint8_t periodMs = 5)
+      : pins_(pins)
+      , activeLow_(activeLow)
+      , lastMs_(0)
+      , periodMs_(periodMs)
+    {
+      reset(0);
+#if defined(__AVR__)
+      // Inputs are not sampled until begin()
+      for (uint8_t i = 0; i < N; i++)
+      {
+        port_[i] = NOT_A_PIN;
+      }
+#endif
+    }
 
-    String result = "";
-    if (days > 0)
+    /*
+      Start debouncing with current levels of inputs as their stable state.
+      Pins should be already configured as inputs.
+    */
+    void begin()
     {
-      result += String(days) + "d ";
+#if defined(__AVR__)
+      for (uint8_t i = 0; i < N; i++)
+      {
+        port_[i] = digitalPinToPort(pins_[i]);
+        mask_[i] = digitalPinToBitMask(pins_[i]);
+      }
+#endif
+      reset((sample() ^ activeLow_) & MASK);
+      lastMs_ = millis();
     }
-    if (result.length() > 0 || hours > 0)
+
+    /*
+      Start debouncing from provided stable state of inputs.
+    */
+    void reset(uint32_t state)
     {
-      result += String(hours) + "h ";
+      state_ = state;
+      cnt0_ = cnt1_ = pressed_ = released_ = 0;
     }
-    if (result.length() > 0 || minutes > 0)
+
+    /*
+      Sample inputs if the sampling period has elapsed.
+
+      RETURN:
+      Flag about a change of debounced state of any input at this call.
+    */
+    bool update()
     {
-      result += String(minutes) + "m ";
+      uint32_t ms = millis();
+      if (ms - lastMs_ < periodMs_)
+      {
+        pressed_ = released_ = 0;
+        return false;
+      }
+      lastMs_ = ms;
+      return tick(sample());
     }
 
-    return result + String(seconds) + "s";
-  }
+    /*
+      Debounce provided sample of inputs.
+
+      PARAMETERS:
+      levels - Bitmask of input levels, where bit 1 means high level.
+        - Data type: 32-bit bitmask
+        - Default value: none
+        - Limited range: 0 ~ 2^N - 1
+
+      RETURN:
+      Flag about a change of debounced state of any input.
+    */
+    bool tick(uint32_t levels)
+    {
+      uint32_t delta = ((levels ^ activeLow_) & MASK) ^ state_;
+      // Counters of inputs equal to the state are cleared, others counted
+      cnt1_ = (cnt1_ ^ cnt0_) & delta;
+      cnt0_ = ~cnt0_ & delta;
+      // Counters wrapped to zero after 4 different samples
+      uint32_t toggle = delta & ~(cnt0_ | cnt1_);
+      state_ ^= toggle;
+      pressed_ = toggle & state_;
+      released_ = toggle & ~state_;
+      return toggle != 0;
+    }
+
+    // Debounced state of inputs, bit 1 means active input
+    uint32_t getState() const { return state_; }
+    // Inputs becoming active at the last update or tick
+    uint32_t getPressed() const { return pressed_; }
+    // Inputs becoming inactive at the last update or tick
+    uint32_t getReleased() const { return released_; }
+    bool isActive(uint8_t input) const { return (state_ >> input) & 1; }
+
+  private:
+    static_assert(N > 0 && N <= 32, "Number of inputs out of range");
+    static const uint32_t MASK = UINT32_MAX >> (32 - N);
+    const uint8_t *pins_;
+    uint32_t activeLow_;
+    uint32_t state_;
+    uint32_t cnt0_;
+    uint32_t cnt1_;
+    uint32_t pressed_;
+    uint32_t released_;
+    uint32_t lastMs_;
+    uint8_t periodMs_;
+#if defined(__AVR__)
+    uint8_t port_[N];
+    uint8_t mask_[N];
+
+    // Read each port input register once
+    uint32_t sample() const
+    {
+      uint8_t ports[16];
+      uint16_t portsRead = 0;
+      uint32_t levels = 0;
+      for (uint8_t i = 0; i < N; i++)
+      {
+        uint8_t port = port_[i];
+        if (port == NOT_A_PIN || port > 15)
+        {
+          continue;
+        }
+        if (!(portsRead & (1U << port)))
+        {
+          ports[port] = *portInputRegister(port);
+          portsRead |= 1U << port;
+        }
+        if (ports[port] & mask_[i])
+        {
+          levels |= 1UL << i;
+        }
+      }
+      return levels;
+    }
+#else
+    uint32_t sample() const
+    {
+      uint32_t levels = 0;
+      for (uint8_t i = 0; i < N; i++)
+      {
+        if (digitalRead(pins_[i]) == HIGH)
+        {
+          levels |= 1UL << i;
+        }
+      }
+      return levels;
+    }
+#endif
+  };
 
   /*
-    Format time period in seconds without spaces.
+    Textual name of microcontroller reboot source.
 
     DESCRIPTION:
-    The method formats input seconds to string with days, hours, minutes,
-    and seconds ([[x]xd][[x]xh][[x]xm][x]xs).
+    The method returns the pointer to the textual name of a reboot source
+    in flash memory without any copying or heap allocation.
+    - Names of built-in reboot sources are stored in a single flash table.
+    - Names of reboot sources registered by an application by the macro
+      GBJ_APPHELPERS_REBOOTS are returned for codes from MCUREBOOT_USER.
+    - The name "Unknown" is returned for codes without a name.
 
     PARAMETERS:
-    totalSeconds - Length of a time period in seconds.
-      - Data type: integer
+    code - Microcontroller internal or application reboot source.
+    - Data type: McuReboots or non-negative integer
+    - Default value: none
+    - Limited range: 0 ~ 255
 
     RETURN:
-    String - formatted textual expresion of a time period.
+    Pointer to the textual name of the reboot source in flash memory.
   */
-  static inline String formatTimePeriodDense(uint32_t totalSeconds)
+  static const __FlashStringHelper *getRebootText(uint8_t code);
+
+  /*
+    Convert microcontroller code to textual name.
+
+    DESCRIPTION:
+    Provided MCU internal reboot code is translated to a textual representation.
+    - The method copies the name from getRebootText() to a string, which is
+      allocated on the heap. Printing the flash name directly is preferable.
+
+    PARAMETERS:
+    code - Microcontroller internal reboot source
+    - Data type: McuReboots
+    - Default value: none
+    - Limited range: none
+
+    RETURN:
+    Textual representation of the MCU reboot source.
+  */
+  static inline String convertReboot2Text(McuReboots code)
   {
-    String result = formatTimePeriod(totalSeconds);
-    result.replace(" ", "");
-    return result;
+    return String(getRebootText(code));
+  }
+
+  // Record of reboot history
+  struct RebootRecord
+  {
+    // Reboot source code
+    uint8_t reason = MCUREBOOT_UNKNOWN;
+    // Uptime in seconds before reboot
+    uint32_t uptime = 0;
+    // Unix epoch time of reboot, 0 if unknown
+    uint32_t epoch = 0;
+  };
+
+  /*
+    Byte addressable persistent storage.
+
+    DESCRIPTION:
+    The interface should be implemented by an application for the storage
+    of persistent data, e.g., EEPROM, RTC memory, or a flash file.
+    - Both methods return false at failure.
+  */
+  class Storage
+  {
+  public:
+    virtual ~Storage() {}
+    virtual bool read(size_t address, uint8_t *data, size_t dataLen) = 0;
+    virtual bool write(size_t address, const uint8_t *data, size_t dataLen) = 0;
+  };
+
+  /*
+    Statistics of reboots.
+
+    DESCRIPTION:
+    The class template keeps the history of the last reboots in a ring buffer
+    and counts reboots of each reboot source.
+    - A record is packed to REBOOT_RECORD_SIZE bytes with a sequence number,
+      running count of its reboot source, and a checksum. Uptime up to
+      97 days is kept in seconds, longer one in minutes.
+    - Counters of reboot sources are 16-bit and saturate. Reboot sources with
+      codes from R are kept in the history only.
+    - The statistics is kept in memory in serialized form, so that it is
+      serialized and deserialized by copying with validation.
+    - Appending a reboot into a storage writes just the new record. No head
+      index is stored, the newest record is located by sequence numbers at
+      loading, and counters are rebuilt from the newest records of reboot
+      sources, so that writes are spread over all records of the ring buffer
+      even for repeating reboot source.
+    - A counter in the header is written only when the last record of its
+      reboot source is going to be replaced, i.e., at most once per N
+      appends. Records and counters damaged by power loss at writing are
+      detected by their checksums and ignored.
+    - If the statistics has not been loaded from or saved into the storage,
+      e.g., erased one, appending writes it entirely for initialization.
+
+    TEMPLATE PARAMETERS:
+    N - Number of records in the ring buffer.
+      - Data type: non-negative integer
+      - Limited range: 1 ~ 128
+
+    R - Number of counted reboot sources.
+      - Data type: non-negative integer
+      - Default value: 32
+      - Limited range: 0 ~ 255
+
+    USAGE:
+    gbj_apphelpers::RebootStats<8> reboots;
+    if (!reboots.load(storage)) reboots.save(storage);
+    reboots.append(storage, code, uptime.getSeconds(), epoch);
+  */
+  template<uint8_t N, uint8_t R = 2 * MCUREBOOT_USER>
+  class RebootStats
+  {
+  public:
+    // Size of serialized statistics in bytes
+    static const size_t SIZE = REBOOT_HEADER_SIZE + R * REBOOT_COUNTER_SIZE +
+                               N * REBOOT_RECORD_SIZE;
+
+    RebootStats() { reset(); }
+
+    /*
+      Clear history and counters.
+    */
+    void reset()
+    {
+      for (uint8_t i = 0; i < R; i++)
+      {
+        setCounter(i, 0);
+      }
+      // Empty records are the same as erased EEPROM
+      memset(record(0), 0xFF, N * REBOOT_RECORD_SIZE);
+      image_[0] = MAGIC;
+      image_[1] = VERSION;
+      image_[2] = N;
+      image_[3] = R;
+      head_ = N - 1;
+      count_ = seq_ = 0;
+      stored_ = false;
+    }
+
+    /*
+      Add reboot to history and counters in memory.
+
+      PARAMETERS:
+      reason - Reboot source code.
+        - Data type: McuReboots or non-negative integer
+        - Default value: none
+        - Limited range: 0 ~ 254
+
+      uptime - Uptime in seconds before reboot.
+        - Data type: non-negative integer
+        - Default value: none
+        - Limited range: 0 ~ 2^32 - 1
+
+      epoch - Unix epoch time of reboot.
+        - Data type: non-negative integer
+        - Default value: 0
+        - Limited range: 0 ~ 2^32 - 1
+    */
+    void add(uint8_t reason, uint32_t uptime, uint32_t epoch = 0)
+    {
+      uint16_t value = 0;
+      if (reason < R)
+      {
+        value = getReasonCount(reason);
+        if (value < UINT16_MAX)
+        {
+          setCounter(reason, ++value);
+        }
+      }
+      head_ = head_ + 1 < N ? head_ + 1 : 0;
+      packReboot(record(head_), seq_++, reason, uptime, epoch, value);
+      if (count_ < N)
+      {
+        count_++;
+      }
+    }
+
+    /*
+      Add reboot and write just changed bytes into storage.
+
+      PARAMETERS:
+      storage - Storage with saved statistics.
+        - Data type: gbj_apphelpers::Storage
+        - Default value: none
+        - Limited range: none
+
+      reason, uptime, epoch - The same as for the method add().
+
+      address - Address of the statistics in the storage.
+        - Data type: non-negative integer
+        - Default value: 0
+        - Limited range: 0 ~ size_t
+
+      RETURN:
+      Success flag of writing.
+    */
+    bool append(Storage &storage,
+                uint8_t reason,
+                uint32_t uptime,
+                uint32_t epoch = 0,
+                size_t address = 0)
+    {
+      // Reboot source of the replaced record if it is the last one of it
+      uint8_t i = head_ + 1 < N ? head_ + 1 : 0;
+      uint8_t replaced = R;
+      if (checkReboot(record(i)) && record(i)[1] < R &&
+          record(i)[1] != reason && !isCountedOutside(record(i)[1], i))
+      {
+        replaced = record(i)[1];
+      }
+      add(reason, uptime, epoch);
+      if (!stored_)
+      {
+        return save(storage, address);
+      }
+      bool result = true;
+      if (replaced < R)
+      {
+        size_t offset = counter(replaced) - image_;
+        result = storage.write(
+          address + offset, &image_[offset], REBOOT_COUNTER_SIZE);
+      }
+      size_t offset = record(head_) - image_;
+      return storage.write(
+               address + offset, record(head_), REBOOT_RECORD_SIZE) &&
+             result;
+    }
+
+    // Number of records in history
+    uint8_t getCount() const { return count_; }
+
+    /*
+      Record from history.
+
+      PARAMETERS:
+      index - Order of a record from the newest one.
+        - Data type: non-negative integer
+        - Default value: none
+        - Limited range: 0 ~ getCount() - 1
+
+      record - Referenced record for a reboot.
+        - Data type: gbj_apphelpers::RebootRecord
+        - Default value: none
+        - Limited range: none
+
+      RETURN:
+      Flag about existence of the record.
+    */
+    bool getRecord(uint8_t index, RebootRecord &rebootRecord) const
+    {
+      if (index >= count_)
+      {
+        return false;
+      }
+      uint8_t i = head_ >= index ? head_ - index : head_ + N - index;
+      unpackReboot(record(i), rebootRecord);
+      return true;
+    }
+
+    // Number of reboots of a reboot source
+    uint16_t getReasonCount(uint8_t reason) const
+    {
+      if (reason >= R)
+      {
+        return 0;
+      }
+      return counter(reason)[0] | counter(reason)[1] << 8;
+    }
+
+    /*
+      Copy statistics to a buffer of at least SIZE bytes.
+
+      RETURN:
+      Number of copied bytes or 0 if the buffer is too small.
+    */
+    size_t serialize(uint8_t *buffer, size_t bufferSize) const
+    {
+      if (bufferSize < SIZE)
+      {
+        return 0;
+      }
+      memcpy(buffer, image_, SIZE);
+      return SIZE;
+    }
+
+    /*
+      Restore statistics from a buffer.
+
+      RETURN:
+      Success flag. The statistics is cleared if the buffer does not contain
+      statistics of the same dimensions.
+    */
+    bool deserialize(const uint8_t *buffer, size_t bufferSize)
+    {
+      if (bufferSize < SIZE)
+      {
+        reset();
+        return false;
+      }
+      memcpy(image_, buffer, SIZE);
+      bool result = restore();
+      stored_ = false;
+      return result;
+    }
+
+    /*
+      Read statistics from a storage.
+
+      RETURN:
+      Success flag. The statistics is cleared if the storage does not contain
+      statistics of the same dimensions.
+    */
+    bool load(Storage &storage, size_t address = 0)
+    {
+      if (!storage.read(address, image_, SIZE))
+      {
+        reset();
+        return false;
+      }
+      stored_ = restore();
+      return stored_;
+    }
+
+    /*
+      Write entire statistics into a storage, e.g., for its initialization.
+    */
+    bool save(Storage &storage, size_t address = 0)
+    {
+      stored_ = storage.write(address, image_, SIZE);
+      return stored_;
+    }
+
+  private:
+    static_assert(N > 0 && N <= 128, "Number of records out of range");
+    static const uint8_t MAGIC = 0xB5;
+    static const uint8_t VERSION = 2;
+    uint8_t image_[SIZE];
+    // Index of the newest record
+    uint8_t head_;
+    uint8_t count_;
+    // Sequence number of the next record
+    uint8_t seq_;
+    // Flag about statistics loaded from or saved into storage
+    bool stored_;
+
+    inline uint8_t *record(uint8_t i)
+    {
+      return &image_[REBOOT_HEADER_SIZE + R * REBOOT_COUNTER_SIZE +
+                     i * REBOOT_RECORD_SIZE];
+    }
+    inline const uint8_t *record(uint8_t i) const
+    {
+      return &image_[REBOOT_HEADER_SIZE + R * REBOOT_COUNTER_SIZE +
+                     i * REBOOT_RECORD_SIZE];
+    }
+    inline uint8_t *counter(uint8_t reason)
+    {
+      return &image_[REBOOT_HEADER_SIZE + reason * REBOOT_COUNTER_SIZE];
+    }
+    inline const uint8_t *counter(uint8_t reason) const
+    {
+      return &image_[REBOOT_HEADER_SIZE + reason * REBOOT_COUNTER_SIZE];
+    }
+    inline void setCounter(uint8_t reason, uint16_t value)
+    {
+      packCounter(counter(reason), value);
+    }
+
+    // Flag about the counter of a reboot source kept in a record except one
+    bool isCountedOutside(uint8_t reason, uint8_t except) const
+    {
+      uint16_t value = getReasonCount(reason);
+      for (uint8_t i = 0; i < N; i++)
+      {
+        if (i != except && checkReboot(record(i)) &&
+            record(i)[1] == reason && rebootCount(record(i)) >= value)
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // Validate header and locate the newest record
+    bool restore()
+    {
+      if (image_[0] != MAGIC || image_[1] != VERSION || image_[2] != N ||
+          image_[3] != R)
+      {
+        reset();
+        return false;
+      }
+      // The newest record is not followed by its successor in sequence
+      head_ = N - 1;
+      count_ = seq_ = 0;
+      for (uint8_t i = 0; i < N; i++)
+      {
+        const uint8_t *next = record(i + 1 < N ? i + 1 : 0);
+        if (checkReboot(record(i)) &&
+            (!checkReboot(next) || next[0] != uint8_t(record(i)[0] + 1)))
+        {
+          head_ = i;
+          seq_ = record(i)[0] + 1;
+          break;
+        }
+      }
+      // Count records of the sequence back from the newest one
+      uint8_t i = head_;
+      uint8_t seq = seq_;
+      while (count_ < N && checkReboot(record(i)) && record(i)[0] == --seq)
+      {
+        count_++;
+        i = i ? i - 1 : N - 1;
+      }
+      // Counters are the greatest of valid ones and counts in records
+      for (i = 0; i < R; i++)
+      {
+        if (!checkCounter(counter(i)))
+        {
+          setCounter(i, 0);
+        }
+      }
+      for (i = 0; i < N; i++)
+      {
+        uint8_t reason = record(i)[1];
+        if (checkReboot(record(i)) && reason < R &&
+            rebootCount(record(i)) > getReasonCount(reason))
+        {
+          setCounter(reason, rebootCount(record(i)));
+        }
+      }
+      return true;
+    }
+  };
+
+  /*
+    Parse compiler day and time format to datetime record.
+
+    DESCRIPTION:
+    The method extracts corresponding parts of a day as well as time
+    structure from strings formatted as a compiler __DATE__ and __TIME__
+    system constants, e.g., "Dec 26 2018" and "12:34:56".
+    - The method is overloaded, either for flashed constants or for generic
+      strings in SRAM.
+
+    PARAMETERS:
+    dtRecord - Referenced structure variable for desired day and time.
+      - Data type: gbj_apphelpers::Datetime
+      - Default value: none
+      - Limited range: address space
+
+    strDate - Pointer to a system day formatted string.
+      - Data type: char pointer
+      - Default value: none
+      - Limited range: address range
+
+    strTime - Pointer to a system time formatted string.
+      - Data type: char pointer
+      - Default value: none
+      - Limited range: address range
+
+    RETURN: none
+  */
+  static void parseDateTime(Datetime &dtRecord,
+                            const char *strDate,
+                            const char *strTime);
+  static void parseDateTime(Datetime &dtRecord,
+                            const __FlashStringHelper *strDate,
+                            const __FlashStringHelper *strTime);
+
+  /*
+    Parse compiler day and time format at compile time.
+
+    DESCRIPTION:
+    The method extracts a datetime record from strings formatted as
+    a compiler __DATE__ and __TIME__ system constants as a compile time
+    constant, so that no parsing code and no flashed strings are needed
+    at runtime.
+    - The year is stored as a full year, e.g., 2018.
+    - The time is stored in 24 hours mode, but the flag about past meridiem
+      is set as well.
+    - The day of a week is counted according to ISO 8601 from 1 for Monday
+      to 7 for Sunday.
+    - For use at runtime the strings are parsed as by the runtime variant,
+      but the year is full and the day of a week is set.
+
+    PARAMETERS:
+    strDate - Pointer to a system day formatted string.
+      - Data type: char pointer
+      - Default value: none
+      - Limited range: address range
+
+    strTime - Pointer to a system time formatted string.
+      - Data type: char pointer
+      - Default value: none
+      - Limited range: address range
+
+    RETURN:
+    Datetime record.
+
+    USAGE:
+    constexpr gbj_apphelpers::Datetime buildTime =
+      gbj_apphelpers::parseDateTime(__DATE__, __TIME__);
+  */
+  static constexpr Datetime parseDateTime(const char *strDate,
+                                          const char *strTime)
+  {
+    return Datetime(constYear(strDate),
+                    constMonth(strDate),
+                    constNumber(&strDate[4]),
+                    constNumber(&strTime[0]),
+                    constNumber(&strTime[3]),
+                    constNumber(&strTime[6]),
+                    (constDays(strDate) + 3) % 7 + 1,
+                    false,
+                    constNumber(&strTime[0]) >= 12);
+  }
+
+  /*
+    Parse compiler day and time format to unix epoch time at compile time.
+
+    DESCRIPTION:
+    The method calculates unix epoch time in seconds from strings formatted
+    as a compiler __DATE__ and __TIME__ system constants as a compile time
+    constant.
+    - The compiler constants are in local time of the build machine, so that
+      is the resulting epoch time.
+
+    PARAMETERS:
+    strDate - Pointer to a system day formatted string.
+      - Data type: char pointer
+      - Default value: none
+      - Limited range: address range
+
+    strTime - Pointer to a system time formatted string.
+      - Data type: char pointer
+      - Default value: none
+      - Limited range: address range
+
+    RETURN:
+    Unix epoch time in seconds.
+
+    USAGE:
+    constexpr unsigned long buildEpoch =
+      gbj_apphelpers::parseEpoch(__DATE__, __TIME__);
+  */
+  static constexpr unsigned long parseEpoch(const char *strDate,
+                                            const char *strTime)
+  {
+    return constDays(strDate) * 86400UL +
+           constNumber(&strTime[0]) * 3600UL +
+           constNumber(&strTime[3]) * 60UL + constNumber(&strTime[6]);
+  }
+
+  /*
+    Parse ISO 8601 datetime string.
+
+    DESCRIPTION:
+    The method parses a datetime string in the extended format of ISO 8601,
+    e.g., "2021-08-16T12:34:56.789+02:00", to datetime record and unix epoch
+    time without using sscanf.
+    - The date alone "YYYY-MM-DD" is accepted as the midnight.
+    - The time "HH:MM[:SS[.fraction]]" is separated by 'T' or space.
+      The fraction of a second is ignored.
+    - The time offset is 'Z' or "+HH:MM", "+HHMM", "+HH", as well as with
+      the minus sign. The time without offset is considered as UTC.
+    - The datetime record is normalized to UTC, i.e., it corresponds to
+      the epoch time and its day of a week is set according to ISO 8601.
+    - Datetime is validated including the days in a month and the leap year.
+      It should be within the range of 32-bit epoch time.
+
+    PARAMETERS:
+    dtRecord - Referenced structure variable for parsed day and time. It is
+      updated only at success.
+      - Data type: gbj_apphelpers::Datetime
+      - Default value: none
+      - Limited range: address space
+
+    str - Pointer to a null terminated datetime string.
+      - Data type: char pointer
+      - Default value: none
+      - Limited range: address range
+
+    epochSeconds - Pointer to a variable for unix epoch time in seconds. It
+      is ignored if not provided.
+      - Data type: unsigned long pointer
+      - Default value: NULL
+      - Limited range: address space
+
+    RETURN:
+    Result code of parsing.
+  */
+  static ParseResults parseIso8601(Datetime &dtRecord,
+                                   const char *str,
+                                   unsigned long *epochSeconds = NULL);
+
+  /*
+    Parse RFC 1123 datetime string.
+
+    DESCRIPTION:
+    The method parses a datetime string in the format of RFC 1123 as it is
+    used in the HTTP Date header, e.g., "Sun, 06 Nov 1994 08:49:37 GMT", to
+    datetime record and unix epoch time without using sscanf.
+    - The name of a day of a week should be valid, but the day of a week is
+      calculated from the date.
+    - The datetime record is in UTC and its day of a week is set according
+      to ISO 8601.
+    - Datetime is validated including the days in a month and the leap year.
+      It should be within the range of 32-bit epoch time.
+
+    PARAMETERS:
+    dtRecord - Referenced structure variable for parsed day and time. It is
+      updated only at success.
+      - Data type: gbj_apphelpers::Datetime
+      - Default value: none
+      - Limited range: address space
+
+    str - Pointer to a null terminated datetime string.
+      - Data type: char pointer
+      - Default value: none
+      - Limited range: address range
+
+    epochSeconds - Pointer to a variable for unix epoch time in seconds. It
+      is ignored if not provided.
+      - Data type: unsigned long pointer
+      - Default value: NULL
+      - Limited range: address space
+
+    RETURN:
+    Result code of parsing.
+  */
+  static ParseResults parseRfc1123(Datetime &dtRecord,
+                                   const char *str,
+                                   unsigned long *epochSeconds = NULL);
+
+  /*
+    Check value for valid range.
+
+    DESCRIPTION:
+    The method tests input value for valid range defined by minimum and
+    maximum value.
+    - Values can of any comparable data type, but all of the same one.
+
+    PARAMETERS:
+    valCur - Checked value.
+    valMin, valMax - Values determining a valid range.
+
+    RETURN:
+    Boolean flag of validity.
+  */
+  template<class T>
+  static inline bool check(T valCur, T valMin, T valMax)
+  {
+    if (valCur < valMin || valCur > valMax)
+    {
+      return false;
+    }
+    return true;
+  }
+
+  /*
+    Sanitize value for valid range and default value.
+
+    DESCRIPTION:
+    The method tests input value for valid range defined by minimum and
+    maximum value. If it is outside of the range, method replaces input value
+    with default value.
+    - Values can of any comparable data type, but all of the same one.
+
+    PARAMETERS:
+    valCur - Sanitized value.
+    valDft - Default value.
+    valMin, valMax - Values determining a valid range.
+
+    RETURN:
+    Current of default value.
+  */
+  template<class T>
+  static inline T sanitize(T valCur, T valDft, T valMin, T valMax)
+  {
+    if (!check(valCur, valMin, valMax))
+    {
+      valCur = valDft;
+    }
+    return valCur;
+  }
+
+  /*
+    Check buffered values for valid range.
+
+    DESCRIPTION:
+    The method tests the first number of data items in a provided buffer for
+    valid range defined by minimum and maximum value and counts invalid ones.
+    - Values can be of any comparable data type, but all of the same one.
+    - The method uses branchless kernel, which compilers can vectorize.
+      For float data on hosts with SSE2 or NEON instructions the kernel uses
+      them explicitly.
+
+    PARAMETERS:
+    dataBuffer - Data buffer with checked data items.
+    dataLen - Number of the first data items in the buffer to check.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ size_t
+
+    valMin, valMax - Values determining a valid range.
+
+    invalidMask - Pointer to a bitmask buffer for flags of invalid items, where
+      bit 0 of the first byte relates to the first data item. The buffer should
+      have at least (dataLen + 7) / 8 bytes. Unused bits of the last byte are
+      cleared.
+      - Data type: byte pointer
+      - Default value: NULL, i.e., no bitmask is provided
+      - Limited range: address space
+
+    RETURN:
+    Number of invalid data items.
+  */
+  template<class T>
+  static inline size_t checkArray(const T *dataBuffer,
+                                  size_t dataLen,
+                                  T valMin,
+                                  T valMax,
+                                  uint8_t *invalidMask = NULL)
+  {
+    return rangeKernel(dataBuffer,
+                       static_cast<T *>(NULL),
+                       dataLen,
+                       valMin,
+                       valMin,
+                       valMax,
+                       invalidMask);
+  }
+
+  /*
+    Sanitize buffered values for valid range and default value.
+
+    DESCRIPTION:
+    The method tests the first number of data items in a provided buffer for
+    valid range defined by minimum and maximum value and replaces those
+    outside of it with default value in place.
+    - Values can be of any comparable data type, but all of the same one.
+    - The method uses branchless kernel, which compilers can vectorize.
+      For float data on hosts with SSE2 or NEON instructions the kernel uses
+      them explicitly.
+
+    PARAMETERS:
+    dataBuffer - Data buffer with sanitized data items.
+    dataLen - Number of the first data items in the buffer to sanitize.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ size_t
+
+    valDft - Default value.
+    valMin, valMax - Values determining a valid range.
+
+    invalidMask - Pointer to a bitmask buffer for flags of replaced items in
+      the same form as for the method checkArray.
+      - Data type: byte pointer
+      - Default value: NULL, i.e., no bitmask is provided
+      - Limited range: address space
+
+    RETURN:
+    Number of replaced data items.
+  */
+  template<class T>
+  static inline size_t sanitizeArray(T *dataBuffer,
+                                     size_t dataLen,
+                                     T valDft,
+                                     T valMin,
+                                     T valMax,
+                                     uint8_t *invalidMask = NULL)
+  {
+    return rangeKernel(
+      dataBuffer, dataBuffer, dataLen, valDft, valMin, valMax, invalidMask);
+  }
+
+  /*
+    Comparators for sorting.
+
+    DESCRIPTION:
+    Function objects determining the order of data items for sorting methods.
+    Each of them returns true if the first item should precede the second one.
+    - Any other function object or function pointer with the same signature
+      can be used for custom ordering.
+  */
+  template<class T>
+  struct CompareAsc
+  {
+    inline bool operator()(const T &item1, const T &item2) const
+    {
+      return item1 < item2;
+    }
+  };
+  template<class T>
+  struct CompareDesc
+  {
+    inline bool operator()(const T &item1, const T &item2) const
+    {
+      return item2 < item1;
+    }
+  };
+
+  /*
+    Sort buffered values by comparator.
+
+    DESCRIPTION:
+    The method sorts the first number of data items in a provided buffer
+    with help of introspective sorting algorithm, i.e., quick sort with
+    median of three pivot, which falls back to heap sort at too deep
+    partitioning and to insertion sort for short partitions.
+    - The time complexity is O(n*log(n)) at worst.
+    - The method does not allocate any memory and the recursion depth is
+      limited to log2(n), so that it is safe on small stacks.
+    - The sorting is not stable, i.e., the order of equal data items is not
+      preserved.
+
+    PARAMETERS:
+    dataBuffer - Data buffer with data items of various data type.
+    dataLen - Number of the first data items in the buffer to sort.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ size_t
+
+    comp - Comparator returning true if the first argument should precede
+      the second one.
+      - Data type: function object or function pointer
+      - Default value: none
+
+    RETURN: None
+  */
+  template<class T, class Compare>
+  static inline void sort(T *dataBuffer, size_t dataLen, Compare comp)
+  {
+    uint8_t depthLimit = 0;
+    for (size_t n = dataLen; n > 1; n >>= 1)
+    {
+      depthLimit += 2;
+    }
+    sortIntro(dataBuffer, dataLen, depthLimit, comp);
+  }
+
+  /*
+    Sort buffered values in ascending or descending order.
+
+    DESCRIPTION:
+    The particular method sorts the first number of data items in a provided
+    buffer in order as indicates its name with introspective sorting.
+    - Values in data buffer can be of any comparable data type.
+
+    PARAMETERS:
+    dataBuffer - Data buffer with data items of various data type.
+    dataLen - Number of the first data items in the buffer to sort.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ size_t
+
+    RETURN: None
+  */
+  template<class T>
+  static inline void sort_asc(T *dataBuffer, size_t dataLen)
+  {
+    sort(dataBuffer, dataLen, CompareAsc<T>());
+  }
+  template<class T>
+  static inline void sort_desc(T *dataBuffer, size_t dataLen)
+  {
+    sort(dataBuffer, dataLen, CompareDesc<T>());
+  }
+
+  /*
+    Sort buffered values by comparator preserving order of equal items.
+
+    DESCRIPTION:
+    The method sorts the first number of data items in a provided buffer
+    with help of in-place merge sorting algorithm, i.e., insertion sorted
+    blocks merged by symmetric merging with rotations.
+    - The sorting is stable, i.e., the order of equal data items is preserved.
+    - The method needs O(n*log(n)) comparisons and O(n*log(n)*log(n)) swaps.
+    - The method does not allocate any memory and the recursion depth is
+      limited to log2(n).
+
+    PARAMETERS:
+    dataBuffer - Data buffer with data items of various data type.
+    dataLen - Number of the first data items in the buffer to sort.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ size_t
+
+    comp - Comparator returning true if the first argument should precede
+      the second one.
+      - Data type: function object or function pointer
+      - Default value: none
+
+    RETURN: None
+  */
+  template<class T, class Compare>
+  static inline void sort_stable(T *dataBuffer, size_t dataLen, Compare comp)
+  {
+    size_t blockSize = SORT_STABLE_BLOCK;
+    size_t a = 0;
+    size_t b = blockSize;
+    while (b <= dataLen)
+    {
+      sortInsertion(dataBuffer + a, blockSize, comp);
+      a = b;
+      b += blockSize;
+    }
+    sortInsertion(dataBuffer + a, dataLen - a, comp);
+    while (blockSize < dataLen)
+    {
+      a = 0;
+      b = 2 * blockSize;
+      while (b <= dataLen)
+      {
+        sortMerge(dataBuffer, a, a + blockSize, b, comp);
+        a = b;
+        b += 2 * blockSize;
+      }
+      if (a + blockSize < dataLen)
+      {
+        sortMerge(dataBuffer, a, a + blockSize, dataLen, comp);
+      }
+      blockSize *= 2;
+    }
+  }
+
+  /*
+    Sort buffered values in ascending or descending order stably.
+
+    DESCRIPTION:
+    The particular method sorts the first number of data items in a provided
+    buffer in order as indicates its name with stable in-place merge sorting.
+    - Values in data buffer can be of any comparable data type.
+
+    PARAMETERS:
+    dataBuffer - Data buffer with data items of various data type.
+    dataLen - Number of the first data items in the buffer to sort.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ size_t
+
+    RETURN: None
+  */
+  template<class T>
+  static inline void sort_stable_asc(T *dataBuffer, size_t dataLen)
+  {
+    sort_stable(dataBuffer, dataLen, CompareAsc<T>());
+  }
+  template<class T>
+  static inline void sort_stable_desc(T *dataBuffer, size_t dataLen)
+  {
+    sort_stable(dataBuffer, dataLen, CompareDesc<T>());
+  }
+
+  /*
+    Sort buffered values in ascending order.
+
+    DESCRIPTION:
+    The method sorts data items in a provided referenced buffer.
+    - The method is kept for backward compatibility and just forwards to the
+      method sort_stable_asc, so that it preserves order of equal data items
+      as the former buble sorting.
+
+    PARAMETERS:
+    dataBuffer - Data buffer with data items of various data type.
+    dataLen - Number of the first data items in the buffer to sort.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ 65535
+
+    RETURN: None
+  */
+  template<class T>
+  static inline void sort_buble_asc(T *dataBuffer, uint16_t dataLen)
+  {
+    sort_stable_asc(dataBuffer, dataLen);
+  }
+
+  /*
+    Sort buffered values in descending order.
+
+    DESCRIPTION:
+    The method sorts the first number of data items in a provided buffer.
+    - The method is kept for backward compatibility and just forwards to the
+      method sort_stable_desc, so that it preserves order of equal data items
+      as the former buble sorting.
+
+    PARAMETERS:
+    dataBuffer - Data buffer with data items of various data type.
+    dataLen - Number of the first data items in the buffer to sort.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ 65535
+
+    RETURN: None
+  */
+  template<class T>
+  static inline void sort_buble_desc(T *dataBuffer, uint16_t dataLen)
+  {
+    sort_stable_desc(dataBuffer, dataLen);
+  }
+
+  /*
+    Select n-th smallest buffered value.
+
+    DESCRIPTION:
+    The method rearranges the first number of data items in a provided buffer
+    so that the item at the n-th position is the one, which would be there
+    in the sorted buffer. All items before it do not follow it and all items
+    after it do not precede it in the order determined by a comparator.
+    - The algorithm is introspective selection, i.e., quick select with
+      median of three pivot falling back to heap sort at too deep
+      partitioning, with expected time complexity O(n).
+    - The method does not allocate any memory.
+
+    PARAMETERS:
+    dataBuffer - Data buffer with data items of various data type.
+    dataLen - Number of the first data items in the buffer to select from.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ size_t
+
+    nth - Zero based position of the selected item in sorted order. Values
+      beyond the data length are limited to the last item.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ dataLen - 1
+
+    comp - Comparator returning true if the first argument should precede
+      the second one.
+      - Data type: function object or function pointer
+      - Default value: CompareAsc
+
+    RETURN:
+    Selected data item or default value of data type for empty buffer.
+  */
+  template<class T, class Compare>
+  static T select_nth(T *dataBuffer, size_t dataLen, size_t nth, Compare comp)
+  {
+    if (dataLen == 0)
+    {
+      return T();
+    }
+    if (nth >= dataLen)
+    {
+      nth = dataLen - 1;
+    }
+    uint8_t depthLimit = 0;
+    for (size_t n = dataLen; n > 1; n >>= 1)
+    {
+      depthLimit += 2;
+    }
+    while (dataLen > SORT_INSERTION_LIMIT)
+    {
+      if (depthLimit == 0)
+      {
+        sortHeap(dataBuffer, dataLen, comp);
+        return dataBuffer[nth];
+      }
+      depthLimit--;
+      size_t cut = sortPartition(dataBuffer, dataLen, comp);
+      if (nth < cut)
+      {
+        dataLen = cut;
+      }
+      else
+      {
+        dataBuffer += cut;
+        dataLen -= cut;
+        nth -= cut;
+      }
+    }
+    sortInsertion(dataBuffer, dataLen, comp);
+    return dataBuffer[nth];
+  }
+  template<class T>
+  static inline T select_nth(T *dataBuffer, size_t dataLen, size_t nth)
+  {
+    return select_nth(dataBuffer, dataLen, nth, CompareAsc<T>());
+  }
+
+  /*
+    Calculate median of buffered values.
+
+    DESCRIPTION:
+    The method determines median of the first number of data items in
+    a provided buffer by selecting the middle item(s) without full sorting.
+    - For even number of items the median is the mean of both middle items,
+      so that the data type should support subtraction and division, e.g.,
+      for integers the mean is rounded down.
+    - The method rearranges data items in the buffer in the same way as the
+      method select_nth.
+
+    PARAMETERS:
+    dataBuffer - Data buffer with data items of various data type.
+    dataLen - Number of the first data items in the buffer to process.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ size_t
+
+    RETURN:
+    Median of data items or default value of data type for empty buffer.
+  */
+  template<class T>
+  static T median(T *dataBuffer, size_t dataLen)
+  {
+    if (dataLen == 0)
+    {
+      return T();
+    }
+    size_t middle = dataLen / 2;
+    T upper = select_nth(dataBuffer, dataLen, middle);
+    if (dataLen & 1)
+    {
+      return upper;
+    }
+    // Lower middle item is the greatest one in the lower partition
+    T lower = dataBuffer[0];
+    for (size_t i = 1; i < middle; i++)
+    {
+      if (lower < dataBuffer[i])
+      {
+        lower = dataBuffer[i];
+      }
+    }
+    return lower + (upper - lower) / 2;
+  }
+
+  /*
+    Determine percentile of buffered values.
+
+    DESCRIPTION:
+    The method determines percentile of the first number of data items in
+    a provided buffer by nearest rank method, i.e., it returns the smallest
+    data item, which is greater than or equal to provided per cent of all
+    data items.
+    - Values in data buffer can be of any comparable data type.
+    - The method rearranges data items in the buffer in the same way as the
+      method select_nth.
+
+    PARAMETERS:
+    dataBuffer - Data buffer with data items of various data type.
+    dataLen - Number of the first data items in the buffer to process.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ size_t
+
+    percent - Percentile rank, where 0 is minimum, 50 is lower median,
+      and 100 is maximum.
+      - Data type: float
+      - Default value: none
+      - Limited range: 0.0 ~ 100.0
+
+    RETURN:
+    Data item at percentile rank or default value of data type for empty
+    buffer.
+  */
+  template<class T>
+  static inline T percentile(T *dataBuffer, size_t dataLen, float percent)
+  {
+    float rank = ceil(percent * dataLen / 100.0);
+    return select_nth(dataBuffer, dataLen, rank > 1.0 ? rank - 1 : 0);
+  }
+
+  /*
+    Running median of a sliding window.
+
+    DESCRIPTION:
+    The class template keeps the last window size of added samples and
+    provides their median after adding each new sample.
+    - The samples are kept in a circular buffer and indexed by a double heap
+      with the median on its top, where items not greater than the median
+      form a max heap and items not lower than the median form a min heap.
+    - Adding a sample replaces the oldest one and restores both heaps
+      in O(log(W)) time. Reading the median is O(1).
+    - All storage is static within the object, no heap memory is allocated.
+      Besides samples the object needs 4 bytes per window item for indexing.
+    - Values can be of any comparable data type. The mean of both middle
+      samples for even number of them requires subtraction and division.
+
+    TEMPLATE PARAMETERS:
+    T - Data type of samples.
+    W - Window size, i.e., number of the last samples in median.
+      - Data type: non-negative integer
+      - Limited range: 1 ~ 32767
+
+    USAGE:
+    gbj_apphelpers::RunningMedian<float, 15> filter;
+    float temperature = filter.add(reading);
+  */
+  template<class T, uint16_t W>
+  class RunningMedian
+  {
+  public:
+    RunningMedian() { reset(); }
+
+    /*
+      Clear the window and start collecting samples again.
+    */
+    void reset()
+    {
+      count_ = idx_ = 0;
+      // Initial filling pattern of heap: median, max, min, max, min, ...
+      for (int16_t i = W - 1; i >= 0; i--)
+      {
+        data_[i] = T();
+        pos_[i] = ((i + 1) / 2) * ((i & 1) ? -1 : 1);
+        heap(pos_[i]) = i;
+      }
+    }
+
+    /*
+      Add a new sample replacing the oldest one in the full window.
+
+      RETURN:
+      Median of samples in the window after adding the new one.
+    */
+    T add(T value)
+    {
+      bool isNew = count_ < W;
+      int16_t p = pos_[idx_];
+      T old = data_[idx_];
+      data_[idx_] = value;
+      if (++idx_ >= W)
+      {
+        idx_ = 0;
+      }
+      count_ += isNew;
+      if (p > 0 && p <= (W - 1) / 2)
+      {
+        // New sample is in min heap
+        if (!isNew && old < value)
+        {
+          minSortDown(p * 2);
+        }
+        else if (minSortUp(p))
+        {
+          maxSortDown(-1);
+        }
+      }
+      else if (p < 0 && p >= -(W / 2))
+      {
+        // New sample is in max heap
+        if (!isNew && value < old)
+        {
+          maxSortDown(p * 2);
+        }
+        else if (maxSortUp(p))
+        {
+          minSortDown(1);
+        }
+      }
+      else
+      {
+        // New sample is at median
+        if (maxCount())
+        {
+          maxSortDown(-1);
+        }
+        if (minCount())
+        {
+          minSortDown(1);
+        }
+      }
+      return getMedian();
+    }
+
+    /*
+      Median of samples, for even number of them the mean of both middle
+      samples, or default value of data type for empty window.
+    */
+    T getMedian() const
+    {
+      T upper = data_[heap(0)];
+      // Equal heap sizes for odd number of samples or empty window
+      if (maxCount() == minCount())
+      {
+        return upper;
+      }
+      T lower = data_[heap(-1)];
+      return lower + (upper - lower) / 2;
+    }
+
+    /*
+      Median of samples, for even number of them the lower middle sample,
+      or default value of data type for empty window.
+    */
+    T getMedianLower() const
+    {
+      return data_[heap(maxCount() == minCount() ? 0 : -1)];
+    }
+
+    uint16_t getCount() const { return count_; }
+    bool isFull() const { return count_ == W; }
+
+  private:
+    static_assert(W > 0 && W < 32768, "Window size out of range");
+    T data_[W];
+    // Heap position of each sample, negative for max heap, zero for median
+    int16_t pos_[W];
+    // Samples indexes in the double heap centered on the median
+    int16_t heap_[W];
+    uint16_t count_;
+    uint16_t idx_;
+
+    inline int16_t &heap(int16_t i) { return heap_[i + W / 2]; }
+    inline int16_t heap(int16_t i) const { return heap_[i + W / 2]; }
+    // Heap sizes are clamped to heap capacities, so that compilers prove
+    // heap items of sift loops to be within bounds of the array
+    inline int16_t minCount() const
+    {
+      int16_t n = (count_ - 1) / 2;
+      return n < (W - 1) / 2 ? n : (W - 1) / 2;
+    }
+    inline int16_t maxCount() const
+    {
+      int16_t n = count_ / 2;
+      return n < W / 2 ? n : W / 2;
+    }
+    inline bool less(int16_t i, int16_t j) const
+    {
+      return data_[heap(i)] < data_[heap(j)];
+    }
+    // Swap heap items i and j if heap item i is lower
+    inline bool exchangeLess(int16_t i, int16_t j)
+    {
+      if (!less(i, j))
+      {
+        return false;
+      }
+      int16_t t = heap(i);
+      heap(i) = heap(j);
+      heap(j) = t;
+      pos_[heap(i)] = i;
+      pos_[heap(j)] = j;
+      return true;
+    }
+    // Restore min heap from heap item i, which is a child of item i/2
+    void minSortDown(int16_t i)
+    {
+      for (; i <= minCount(); i *= 2)
+      {
+        if (i > 1 && i < minCount() && less(i + 1, i))
+        {
+          ++i;
+        }
+        if (!exchangeLess(i, i / 2))
+        {
+          break;
+        }
+      }
+    }
+    // Restore max heap from heap item i, which is a child of item i/2
+    void maxSortDown(int16_t i)
+    {
+      for (; i >= -maxCount(); i *= 2)
+      {
+        if (i < -1 && i > -maxCount() && less(i, i - 1))
+        {
+          --i;
+        }
+        if (!exchangeLess(i / 2, i))
+        {
+          break;
+        }
+      }
+    }
+    // Restore min heap above heap item i, true if median changed
+    bool minSortUp(int16_t i)
+    {
+      while (i > 0 && exchangeLess(i, i / 2))
+      {
+        i /= 2;
+      }
+      return i == 0;
+    }
+    // Restore max heap above heap item i, true if median changed
+    bool maxSortUp(int16_t i)
+    {
+      while (i < 0 && exchangeLess(i / 2, i))
+      {
+        i /= 2;
+      }
+      return i == 0;
+    }
+  };
+
+  /*
+    Running statistics of a sliding window.
+
+    DESCRIPTION:
+    The class template keeps the last window size of added samples and
+    provides their mean, variance, minimum, and maximum after adding each new
+    sample.
+    - Mean and variance are updated incrementally by the Welford's method
+      extended to replacing the oldest sample, which is numerically stable
+      unlike summing of samples and their squares. Samples are shifted by
+      the first one, so that large values with small variation, e.g.,
+      pressures in pascals, do not lose precision.
+    - Minimum and maximum are kept at the front of monotonic deques of
+      window indexes. A sample is added to each of them at most once and
+      removed at most once, so that adding is O(1) amortized.
+    - All queries are O(1). All storage is static within the object, no heap
+      memory is allocated. Besides samples the object needs 4 bytes per
+      window item for both deques.
+    - Values can be of any data type comparable by the operator "less than".
+      Mean and variance are calculated in the accumulator data type, to which
+      values should be convertible. For the void accumulator data type only
+      minimum and maximum are provided.
+
+    TEMPLATE PARAMETERS:
+    T - Data type of samples.
+    W - Window size, i.e., number of the last samples in statistics.
+      - Data type: non-negative integer
+      - Limited range: 1 ~ 32767
+    A - Accumulator data type for mean and variance.
+      - Default value: double
+
+    USAGE:
+    gbj_apphelpers::RunningStats<int16_t, 60> stats;
+    stats.add(reading);
+    double average = stats.getMean();
+  */
+  template<class T, uint16_t W, class A = double>
+  class RunningStats
+  {
+  public:
+    RunningStats() { reset(); }
+
+    /*
+      Clear the window and start collecting samples again.
+    */
+    void reset()
+    {
+      count_ = idx_ = 0;
+      minHead_ = minCount_ = maxHead_ = maxCount_ = 0;
+      moments_.reset();
+    }
+
+    /*
+      Add a new sample replacing the oldest one in the full window.
+    */
+    void add(T value)
+    {
+      if (count_ < W)
+      {
+        count_++;
+        moments_.add(value, count_);
+      }
+      else
+      {
+        moments_.replace(value, data_[idx_], count_);
+        // The oldest sample can be just at the front of a deque
+        if (minDeque_[minHead_] == idx_)
+        {
+          popFront(minHead_, minCount_);
+        }
+        if (maxDeque_[maxHead_] == idx_)
+        {
+          popFront(maxHead_, maxCount_);
+        }
+      }
+      data_[idx_] = value;
+      // Samples not lower than the new one can never be minimum again
+      while (minCount_ &&
+             !(data_[minDeque_[back(minHead_, minCount_)]] < value))
+      {
+        minCount_--;
+      }
+      pushBack(minDeque_, minHead_, minCount_);
+      // Samples not greater than the new one can never be maximum again
+      while (maxCount_ &&
+             !(value < data_[maxDeque_[back(maxHead_, maxCount_)]]))
+      {
+        maxCount_--;
+      }
+      pushBack(maxDeque_, maxHead_, maxCount_);
+      if (++idx_ >= W)
+      {
+        idx_ = 0;
+      }
+    }
+
+    // Minimum of samples or default value of data type for empty window
+    T getMin() const { return count_ ? data_[minDeque_[minHead_]] : T(); }
+    // Maximum of samples or default value of data type for empty window
+    T getMax() const { return count_ ? data_[maxDeque_[maxHead_]] : T(); }
+    // Mean of samples or zero for empty window
+    A getMean() const { return moments_.mean(); }
+    // Sample variance or zero for less than two samples
+    A getVariance() const { return moments_.variance(count_); }
+    // Sample standard deviation or zero for less than two samples
+    A getDeviation() const { return sqrt(getVariance()); }
+
+    uint16_t getCount() const { return count_; }
+    bool isFull() const { return count_ == W; }
+
+  private:
+    static_assert(W > 0 && W < 32768, "Window size out of range");
+
+    // Mean and sum of squared deviations by the Welford's method. Values are
+    // shifted by the first sample to reduce rounding errors of large ones.
+    template<class B, class Dummy = void>
+    struct Moments
+    {
+      B shift_;
+      B mean_;
+      B m2_;
+      void reset() { shift_ = mean_ = m2_ = B(); }
+      void add(T value, uint16_t count)
+      {
+        if (count == 1)
+        {
+          shift_ = static_cast<B>(value);
+        }
+        B x = static_cast<B>(value) - shift_;
+        B delta = x - mean_;
+        mean_ += delta / count;
+        m2_ += delta * (x - mean_);
+      }
+      void replace(T value, T old, uint16_t count)
+      {
+        B x = static_cast<B>(value) - shift_;
+        B y = static_cast<B>(old) - shift_;
+        B meanOld = mean_;
+        mean_ += (x - y) / count;
+        m2_ += (x - y) * (x - mean_ + y - meanOld);
+      }
+      B mean() const { return shift_ + mean_; }
+      B variance(uint16_t count) const
+      {
+        // Rounding errors of replacing can make tiny negative sum
+        return count > 1 && m2_ > B() ? m2_ / (count - 1) : B();
+      }
+    };
+    template<class Dummy>
+    struct Moments<void, Dummy>
+    {
+      void reset() {}
+      void add(T, uint16_t) {}
+      void replace(T, T, uint16_t) {}
+    };
+
+    T data_[W];
+    // Circular deques of window indexes with ascending and descending samples
+    uint16_t minDeque_[W];
+    uint16_t maxDeque_[W];
+    Moments<A> moments_;
+    uint16_t count_;
+    uint16_t idx_;
+    uint16_t minHead_, minCount_;
+    uint16_t maxHead_, maxCount_;
+
+    static inline uint16_t back(uint16_t head, uint16_t count)
+    {
+      return head + count - 1 < W ? head + count - 1 : head + count - 1 - W;
+    }
+    inline void pushBack(uint16_t *deque, uint16_t head, uint16_t &count)
+    {
+      count++;
+      deque[back(head, count)] = idx_;
+    }
+    static inline void popFront(uint16_t &head, uint16_t &count)
+    {
+      head = head + 1 < W ? head + 1 : 0;
+      count--;
+    }
+  };
+
+  /*
+    Exponential moving average.
+
+    DESCRIPTION:
+    The class template smooths samples by the exponential moving average,
+    i.e., the first order low-pass IIR filter
+    y = y + (x - y) / 2^K, with time constant about 2^K samples.
+    - The coefficient is a power of two, so that integer samples are
+      filtered just by additions and shifts without floating point
+      arithmetic, which is important for microcontrollers without FPU.
+    - The integer state keeps the output with K fractional bits in the form
+      of the sum S = S + x - round(S / 2^K), so that the output converges
+      exactly to a steady input without a dead band.
+    - Specialization for float samples filters in floating point arithmetic
+      with the same coefficient, e.g., for microcontrollers with FPU.
+    - The first sample initializes the output.
+
+    TEMPLATE PARAMETERS:
+    T - Data type of samples, an integer one or float.
+    K - Power of two of the smoothing divisor.
+      - Data type: non-negative integer
+      - Limited range: 1 ~ bits of S minus bits of T minus 1
+    S - Signed integer data type of the state.
+      - Default value: int32_t
+
+    USAGE:
+    gbj_apphelpers::FilterEma<int16_t, 3> filter;
+    int16_t smoothed = filter.add(analogRead(A0));
+  */
+  template<class T, uint8_t K, class S = int32_t>
+  class FilterEma
+  {
+  public:
+    FilterEma() { reset(); }
+
+    /*
+      Start filtering again from the next sample.
+    */
+    void reset()
+    {
+      state_ = 0;
+      primed_ = false;
+    }
+
+    /*
+      Start filtering from provided output value.
+    */
+    void reset(T value)
+    {
+      state_ = static_cast<S>(value) * (S(1) << K);
+      primed_ = true;
+    }
+
+    /*
+      Add a new sample.
+
+      RETURN:
+      Filtered value.
+    */
+    T add(T value)
+    {
+      if (!primed_)
+      {
+        reset(value);
+        return value;
+      }
+      state_ += static_cast<S>(value) - roundShift(state_);
+      return getValue();
+    }
+
+    // Filtered value or zero before the first sample
+    T getValue() const { return static_cast<T>(roundShift(state_)); }
+
+  private:
+    static_assert(T(1) / T(2) == T(0), "Integer samples or float expected");
+    static_assert(K > 0 && 8 * sizeof(T) + K < 8 * sizeof(S),
+                  "Smoothing shift out of range");
+    S state_;
+    bool primed_;
+
+    // Division by 2^K rounded to the nearest integer
+    static inline S roundShift(S state)
+    {
+      return (state + (S(1) << (K - 1))) >> K;
+    }
+  };
+  template<uint8_t K, class S>
+  class FilterEma<float, K, S>
+  {
+  public:
+    FilterEma() { reset(); }
+    void reset()
+    {
+      value_ = 0;
+      primed_ = false;
+    }
+    void reset(float value)
+    {
+      value_ = value;
+      primed_ = true;
+    }
+    float add(float value)
+    {
+      if (!primed_)
+      {
+        reset(value);
+        return value;
+      }
+      value_ += (value - value_) * (1.0f / (1UL << K));
+      return value_;
+    }
+    float getValue() const { return value_; }
+
+  private:
+    static_assert(K > 0 && K < 32, "Smoothing shift out of range");
+    float value_;
+    bool primed_;
+  };
+
+  /*
+    Second order low-pass IIR filter.
+
+    DESCRIPTION:
+    The class template smooths samples by two cascaded exponential moving
+    averages with coefficients 1 / 2^K1 and 1 / 2^K2, i.e., a critically
+    damped second order low-pass filter without overshooting, which
+    suppresses noise better than the first order one.
+    - Integer samples are filtered just by additions and shifts. The first
+      stage keeps one guard bit and its output is passed to the second one
+      with K1 + 1 fractional bits, so that rounding residues of both stages
+      stay below a half and the output converges exactly to a steady input.
+    - Specialization for float samples filters in floating point arithmetic
+      with the same coefficients.
+    - The first sample initializes the output.
+
+    TEMPLATE PARAMETERS:
+    T - Data type of samples, an integer one or float.
+    K1, K2 - Powers of two of smoothing divisors of stages.
+      - Data type: non-negative integer
+      - Default value: K2 = K1
+      - Limited range: 1 ~ bits of S minus bits of T minus 2 in sum
+    S - Signed integer data type of the state.
+      - Default value: int32_t
+
+    USAGE:
+    gbj_apphelpers::FilterIir2<int16_t, 2> filter;
+    int16_t smoothed = filter.add(analogRead(A0));
+  */
+  template<class T, uint8_t K1, uint8_t K2 = K1, class S = int32_t>
+  class FilterIir2
+  {
+  public:
+    FilterIir2() { reset(); }
+
+    /*
+      Start filtering again from the next sample.
+    */
+    void reset()
+    {
+      state1_ = state2_ = 0;
+      primed_ = false;
+    }
+
+    /*
+      Start filtering from provided output value of both stages.
+    */
+    void reset(T value)
+    {
+      state1_ = static_cast<S>(value) * (S(1) << (K1 + GUARD));
+      state2_ = state1_ * (S(1) << K2);
+      primed_ = true;
+    }
+
+    /*
+      Add a new sample.
+
+      RETURN:
+      Filtered value.
+    */
+    T add(T value)
+    {
+      if (!primed_)
+      {
+        reset(value);
+        return value;
+      }
+      state1_ += static_cast<S>(value) * (S(1) << GUARD) -
+                 roundShift<K1>(state1_);
+      state2_ += state1_ - roundShift<K2>(state2_);
+      return getValue();
+    }
+
+    // Filtered value or zero before the first sample
+    T getValue() const
+    {
+      return static_cast<T>(roundShift<K1 + K2 + GUARD>(state2_));
+    }
+
+  private:
+    static_assert(T(1) / T(2) == T(0), "Integer samples or float expected");
+    static const uint8_t GUARD = 1;
+    static_assert(K1 > 0 && K2 > 0 &&
+                    8 * sizeof(T) + K1 + K2 + GUARD < 8 * sizeof(S),
+                  "Smoothing shifts out of range");
+    S state1_;
+    S state2_;
+    bool primed_;
+
+    template<uint8_t N>
+    static inline S roundShift(S state)
+    {
+      return (state + (S(1) << (N - 1))) >> N;
+    }
+  };
+  template<uint8_t K1, uint8_t K2, class S>
+  class FilterIir2<float, K1, K2, S>
+  {
+  public:
+    FilterIir2() { reset(); }
+    void reset()
+    {
+      value1_ = value2_ = 0;
+      primed_ = false;
+    }
+    void reset(float value)
+    {
+      value1_ = value2_ = value;
+      primed_ = true;
+    }
+    float add(float value)
+    {
+      if (!primed_)
+      {
+        reset(value);
+        return value;
+      }
+      value1_ += (value - value1_) * (1.0f / (1UL << K1));
+      value2_ += (value1_ - value2_) * (1.0f / (1UL << K2));
+      return value2_;
+    }
+    float getValue() const { return value2_; }
+
+  private:
+    static_assert(K1 > 0 && K1 < 32 && K2 > 0 && K2 < 32,
+                  "Smoothing shifts out of range");
+    float value1_;
+    float value2_;
+    bool primed_;
+  };
+
+  /*
+    Swap two data items.
+
+    DESCRIPTION:
+    The method swappes input data items pair upside down.
+
+    PARAMETERS:
+    item1, item2 - Referenced data items to be swapped.
+      - Data type: various
+
+    RETURN: none
+  */
+  template<class T>
+  static inline void swapdata(T &item1, T &item2)
+  {
+    T temp = item1;
+    item1 = item2;
+    item2 = temp;
+  }
+
+  /*
+    Format daily time in seconds.
+
+    DESCRIPTION:
+    The method formats input seconds to string with hours, minutes,
+    and seconds all with leading zeros (??:??:??).
+    - The method is overloaded, either for writing into a provided character
+      buffer without any heap allocation or for returning a String.
+
+    PARAMETERS:
+    buffer - Pointer to a character buffer for formatted null terminated
+      string.
+      - Data type: char pointer
+      - Default value: none
+      - Limited range: address space
+
+    bufferSize - Size of the buffer including terminating null character.
+      It should be at least FORMAT_TIMEDAY_LEN + 1.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ size_t
+
+    totalSeconds - Seconds since midnight.
+      - Data type: 32-bit integer
+
+    RETURN:
+    size_t - length of formatted string or 0 if the buffer is too small,
+      while empty string is written into it.
+    String - formatted textual expression of a time within a day.
+  */
+  static inline size_t formatTimeDay(char *buffer,
+                                     size_t bufferSize,
+                                     uint32_t totalSeconds)
+  {
+    if (bufferSize <= FORMAT_TIMEDAY_LEN)
+    {
+      return formatEmpty(buffer, bufferSize);
+    }
+    uint8_t seconds = totalSeconds % 60;
+
+    uint32_t totalMinutes = totalSeconds / 60;
+    uint8_t minutes = totalMinutes % 60;
+
+    uint32_t totalHours = totalMinutes / 60;
+    uint8_t hours = totalHours % 24;
+
+    *formatTime(buffer, hours, minutes, seconds) = '\0';
+    return FORMAT_TIMEDAY_LEN;
+  }
+  static inline String formatTimeDay(uint32_t totalSeconds)
+  {
+    char result[FORMAT_TIMEDAY_LEN + 1];
+    formatTimeDay(result, sizeof(result), totalSeconds);
+    return result;
+  }
+
+  /*
+    Format time period in seconds.
+
+    DESCRIPTION:
+    The method formats input seconds to string with days, hours, minutes,
+    and seconds ([[x]xd ][[x]xh ][[x]xm ][x]xs).
+    - The method is overloaded, either for writing into a provided character
+      buffer without any heap allocation or for returning a String.
+
+    PARAMETERS:
+    buffer - Pointer to a character buffer for formatted null terminated
+      string.
+      - Data type: char pointer
+      - Default value: none
+      - Limited range: address space
+
+    bufferSize - Size of the buffer including terminating null character.
+      It should be at least FORMAT_TIMEPERIOD_LEN + 1.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ size_t
+
+    totalSeconds - Length of a time period in seconds.
+      - Data type: integer
+
+    RETURN:
+    size_t - length of formatted string or 0 if the buffer is too small,
+      while empty string is written into it.
+    String - formatted textual expresion of a time period.
+  */
+  static inline size_t formatTimePeriod(char *buffer,
+                                        size_t bufferSize,
+                                        uint32_t totalSeconds)
+  {
+    return formatPeriod(buffer, bufferSize, totalSeconds, ' ');
+  }
+  static inline String formatTimePeriod(uint32_t totalSeconds)
+  {
+    char result[FORMAT_TIMEPERIOD_LEN + 1];
+    formatTimePeriod(result, sizeof(result), totalSeconds);
+    return result;
+  }
+
+  /*
+    Format time period in seconds without spaces.
+
+    DESCRIPTION:
+    The method formats input seconds to string with days, hours, minutes,
+    and seconds ([[x]xd][[x]xh][[x]xm][x]xs).
+    - The method is overloaded, either for writing into a provided character
+      buffer without any heap allocation or for returning a String.
+
+    PARAMETERS:
+    buffer - Pointer to a character buffer for formatted null terminated
+      string.
+      - Data type: char pointer
+      - Default value: none
+      - Limited range: address space
+
+    bufferSize - Size of the buffer including terminating null character.
+      It should be at least FORMAT_TIMEPERIODDENSE_LEN + 1.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ size_t
+
+    totalSeconds - Length of a time period in seconds.
+      - Data type: integer
+
+    RETURN:
+    size_t - length of formatted string or 0 if the buffer is too small,
+      while empty string is written into it.
+    String - formatted textual expresion of a time period.
+  */
+  static inline size_t formatTimePeriodDense(char *buffer,
+                                             size_t bufferSize,
+                                             uint32_t totalSeconds)
+  {
+    return formatPeriod(buffer, bufferSize, totalSeconds, '\0');
+  }
+  static inline String formatTimePeriodDense(uint32_t totalSeconds)
+  {
+    char result[FORMAT_TIMEPERIODDENSE_LEN + 1];
+    formatTimePeriodDense(result, sizeof(result), totalSeconds);
+    return result;
+  }
+
+  /*
+    Format unix epoch time in seconds.
+
+    DESCRIPTION:
+    The method formats input seconds as a unix epoch time to date and time
+    string all with leading zeros (dd.mm.yyyy HH:MM:SS).
+    - The method is overloaded, either for writing into a provided character
+      buffer without any heap allocation or for returning a String.
+
+    PARAMETERS:
+    buffer - Pointer to a character buffer for formatted null terminated
+      string.
+      - Data type: char pointer
+      - Default value: none
+      - Limited range: address space
+
+    bufferSize - Size of the buffer including terminating null character.
+      It should be at least FORMAT_EPOCHSECONDS_LEN + 1.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ size_t
+
+    epochSeconds - Seconds since 01.01.1970 00:00:00.
+      - Data type: 32-bit integer
+
+    RETURN:
+    size_t - length of formatted string or 0 if the buffer is too small,
+      while empty string is written into it.
+    String - formatted textual expression of a date and time.
+  */
+  static inline size_t formatEpochSeconds(char *buffer,
+                                          size_t bufferSize,
+                                          unsigned long epochSeconds)
+  {
+    if (bufferSize <= FORMAT_EPOCHSECONDS_LEN)
+    {
+      return formatEmpty(buffer, bufferSize);
+    }
+    Datetime dtRecord;
+    convertEpoch2Datetime(dtRecord, epochSeconds);
+    // Format output dd.mm.yyyy HH:MM:SS
+    char *p = formatDate(buffer, dtRecord);
+    *p++ = ' ';
+    p = formatTime(p, dtRecord.hour, dtRecord.minute, dtRecord.second);
+    *p = '\0';
+    return FORMAT_EPOCHSECONDS_LEN;
+  }
+  static inline String formatEpochSeconds(unsigned long epochSeconds)
+  {
+    char result[FORMAT_EPOCHSECONDS_LEN + 1];
+    formatEpochSeconds(result, sizeof(result), epochSeconds);
+    return result;
+  }
+
+  /*
+    Format milliseconds to time period.
+
+    DESCRIPTION:
+    The method formats input milliseconds to string with days, hours, minutes,
+    and seconds ([[x]xd ][[x]xh ][[x]xm ][x]xs).
+    - This is the wrapper method for methods 'formatTimePeriod' and
+    'convertMs2Sec'.
+    - The method is overloaded, either for writing into a provided character
+      buffer without any heap allocation or for returning a String.
+
+    PARAMETERS:
+    buffer - Pointer to a character buffer for formatted null terminated
+      string.
+      - Data type: char pointer
+      - Default value: none
+      - Limited range: address space
+
+    bufferSize - Size of the buffer including terminating null character.
+      It should be at least FORMAT_TIMEPERIOD_LEN + 1.
+      - Data type: non-negative integer
+      - Default value: none
+      - Limited range: 0 ~ size_t
+
+    ms - Milliseconds to be converted to seconds and formatted to time period.
+      - Data type: unsigned long integer
+      - Default value: none
+      - Limited range: 0 ~ (2^32 - 1)
+
+    RETURN:
+    size_t - length of formatted string or 0 if the buffer is too small,
+      while empty string is written into it.
+    String - formatted textual expresion of a time period provided in
+      milliseconds.
+  */
+  static inline size_t formatMsPeriod(char *buffer,
+                                      size_t bufferSize,
+                                      uint32_t ms)
+  {
+    return formatTimePeriod(buffer, bufferSize, convertMs2Sec(ms));
+  }
+  static inline String formatMsPeriod(uint32_t ms)
+  {
+    return formatTimePeriod(convertMs2Sec(ms));
+  }
+
+  /*
+    Incremental formatter of unix epoch time.
+
+    DESCRIPTION:
+    The class formats input seconds as a unix epoch time to the same date and
+    time string as the method formatEpochSeconds (dd.mm.yyyy HH:MM:SS), but
+    it keeps the last formatted string and the day it belongs to.
+    - While the day of subsequent epochs is unchanged, only the digits of the
+      time are rewritten in place. The calendar date is calculated and
+      rendered only once a day.
+    - Epochs need not be monotonic, just the change of the day is slower.
+    - No heap memory is allocated.
+
+    USAGE:
+    gbj_apphelpers::EpochFormatter timestamp;
+    Serial.println(timestamp.format(epochSeconds));
+  */
+  class EpochFormatter
+  {
+  public:
+    EpochFormatter() { reset(); }
+
+    /*
+      Forget the cached day, so that the next epoch is formatted entirely.
+    */
+    inline void reset() { day_ = UINT32_MAX; }
+
+    /*
+      Format epoch time into internal buffer.
+
+      PARAMETERS:
+      epochSeconds - Seconds since 01.01.1970 00:00:00.
+        - Data type: 32-bit integer
+
+      RETURN:
+      Pointer to formatted null terminated string valid until next
+      formatting.
+    */
+    const char *format(unsigned long epochSeconds);
+
+    /*
+      Format epoch time into provided buffer.
+
+      PARAMETERS:
+      buffer - Pointer to a character buffer for formatted null terminated
+        string.
+        - Data type: char pointer
+        - Default value: none
+        - Limited range: address space
+
+      bufferSize - Size of the buffer including terminating null character.
+        It should be at least FORMAT_EPOCHSECONDS_LEN + 1.
+        - Data type: non-negative integer
+        - Default value: none
+        - Limited range: 0 ~ size_t
+
+      epochSeconds - Seconds since 01.01.1970 00:00:00.
+        - Data type: 32-bit integer
+
+      RETURN:
+      Length of formatted string or 0 if the buffer is too small, while empty
+      string is written into it.
+    */
+    inline size_t format(char *buffer,
+                         size_t bufferSize,
+                         unsigned long epochSeconds)
+    {
+      if (bufferSize <= FORMAT_EPOCHSECONDS_LEN)
+      {
+        return formatEmpty(buffer, bufferSize);
+      }
+      memcpy(buffer, format(epochSeconds), FORMAT_EPOCHSECONDS_LEN + 1);
+      return FORMAT_EPOCHSECONDS_LEN;
+    }
+
+  private:
+    // Position of hours in "dd.mm.yyyy HH:MM:SS"
+    static const uint8_t TIME_POS = 11;
+    char text_[FORMAT_EPOCHSECONDS_LEN + 1];
+    uint32_t day_;
+    uint32_t second_;
+  };
+
+  /*
+    Provide URL encoding of the string.
+
+    DESCRIPTION:
+    The method escapes funny characters in a URL. For example a space is: %20.
+    - Characters kept unescaped are determined by the encoding mode and
+      looked up in a table.
+
+    PARAMETERS:
+    str - String to be encoded.
+    - Data type: String
+    - Default value: none
+    - Limited range: none
+
+    mode - Encoding mode determining the set of characters not escaped.
+    - Data type: UrlModes
+    - Default value: URLMODE_ALNUM
+    - Limited range: URLMODE_ALNUM, URLMODE_FORM, URLMODE_RFC3986
+
+    RETURN:
+    URL encoded string.
+
+    CREDIT:
+    ESP8266 Hello World urlencode by Steve Nelson.
+    https://github.com/zenmanenergy/ESP8266-Arduino-Examples/tree/master/helloWorld_urlencoded
+  */
+  static String urlencode(const String &str, UrlModes mode = URLMODE_ALNUM);
+
+  /*
+    Provide URL encoding of a character buffer or a stream into a sink.
+
+    DESCRIPTION:
+    The method encodes input characters in the same way as the String variant,
+    but writes the encoded characters straight into a print sink, e.g.,
+    a WiFiClient or Serial, without any heap allocation.
+    - The encoded characters are collected in a small chunk on the stack and
+      written to the sink by the entire chunks.
+    - The method yields to the system only after several chunks or after
+      a time budget instead of every character.
+    - Runs of characters kept unescaped are copied to the chunk at once.
+    - The stream variant encodes all characters available in the stream.
+
+    PARAMETERS:
+    sink - Referenced object for writing encoded characters.
+    - Data type: Print
+    - Default value: none
+    - Limited range: none
+
+    str - Pointer to characters to be encoded, not necessarily null
+      terminated.
+    - Data type: char pointer
+    - Default value: none
+    - Limited range: address space
+
+    strLen - Number of characters to be encoded.
+    - Data type: non-negative integer
+    - Default value: none
+    - Limited range: 0 ~ size_t
+
+    source - Referenced stream with characters to be encoded.
+    - Data type: Stream
+    - Default value: none
+    - Limited range: none
+
+    mode - Encoding mode determining the set of characters not escaped.
+    - Data type: UrlModes
+    - Default value: URLMODE_ALNUM
+    - Limited range: URLMODE_ALNUM, URLMODE_FORM, URLMODE_RFC3986
+
+    RETURN:
+    Number of characters written into the sink.
+  */
+  static size_t urlencode(Print &sink,
+                          const char *str,
+                          size_t strLen,
+                          UrlModes mode = URLMODE_ALNUM);
+  static size_t urlencode(Print &sink,
+                          Stream &source,
+                          UrlModes mode = URLMODE_ALNUM);
+
+  /*
+    Calculate length of URL encoded characters.
+
+    DESCRIPTION:
+    The method calculates number of characters produced by URL encoding of
+    the input characters without encoding them, e.g., for exact reservation
+    of a buffer or for the Content-Length header of a HTTP request.
+
+    PARAMETERS:
+    str - Pointer to characters to be encoded, not necessarily null
+      terminated.
+    - Data type: char pointer
+    - Default value: none
+    - Limited range: address space
+
+    strLen - Number of characters to be encoded.
+    - Data type: non-negative integer
+    - Default value: none
+    - Limited range: 0 ~ size_t
+
+    mode - Encoding mode determining the set of characters not escaped.
+    - Data type: UrlModes
+    - Default value: URLMODE_ALNUM
+    - Limited range: URLMODE_ALNUM, URLMODE_FORM, URLMODE_RFC3986
+
+    RETURN:
+    Length of URL encoded characters.
+  */
+  static size_t urlencodeLength(const char *str,
+                                size_t strLen,
+                                UrlModes mode = URLMODE_ALNUM);
+
+  /*
+    Provide URL decoding of the string.
+
+    DESCRIPTION:
+    The method converts all URL encoded characters to original funny characters
+    from a URL. For example a space is: %20.
+
+    PARAMETERS:
+    str - String to be decoded.
+    - Data type: String
+    - Default value: none
+    - Limited range: none
+
+    RETURN:
+    URL decoded string.
+
+    CREDIT:
+    ESP8266 Hello World urlencode by Steve Nelson.
+    https://github.com/zenmanenergy/ESP8266-Arduino-Examples/tree/master/helloWorld_urlencoded
+  */
+  static String urldecode(const String &str);
+
+  /*
+    Provide URL decoding of a character buffer or a stream into a sink.
+
+    DESCRIPTION:
+    The method decodes input characters in the same way as the in-place
+    variant, but writes the decoded characters straight into a print sink
+    without any heap allocation.
+    - The decoded characters are collected in a small chunk on the stack and
+      written to the sink by the entire chunks.
+    - The method yields to the system only after several chunks or after
+      a time budget instead of every character.
+    - An escape sequence not followed by two hexadecimal digits, including
+      a truncated one at the end of input, is malformed. It is written to
+      the sink unchanged and counted.
+    - The stream variant decodes all characters available in the stream.
+
+    PARAMETERS:
+    sink - Referenced object for writing decoded characters.
+    - Data type: Print
+    - Default value: none
+    - Limited range: none
+
+    str - Pointer to characters to be decoded, not necessarily null
+      terminated.
+    - Data type: char pointer
+    - Default value: none
+    - Limited range: address space
+
+    strLen - Number of characters to be decoded.
+    - Data type: non-negative integer
+    - Default value: none
+    - Limited range: 0 ~ size_t
+
+    source - Referenced stream with characters to be decoded.
+    - Data type: Stream
+    - Default value: none
+    - Limited range: none
+
+    malformed - Pointer to a variable for number of malformed escape
+      sequences. It is ignored if not provided.
+    - Data type: size_t pointer
+    - Default value: NULL
+    - Limited range: address space
+
+    RETURN:
+    Number of characters written into the sink.
+  */
+  static size_t urldecode(Print &sink,
+                          const char *str,
+                          size_t strLen,
+                          size_t *malformed = NULL);
+  static size_t urldecode(Print &sink,
+                          Stream &source,
+                          size_t *malformed = NULL);
+
+  /*
+    Provide URL decoding of a character buffer in place.
+
+    DESCRIPTION:
+    The method decodes input characters in the same way as the String variant
+    right in the input buffer, because decoded characters are never longer
+    than encoded ones. No heap memory is allocated.
+    - An escape sequence not followed by two hexadecimal digits, including
+      a truncated one at the end of input, is malformed. It is kept in the
+      buffer unchanged and counted.
+    - The decoded characters are terminated by null character if they are
+      shorter than the input ones.
+
+    PARAMETERS:
+    buffer - Pointer to characters to be decoded, not necessarily null
+      terminated.
+    - Data type: char pointer
+    - Default value: none
+    - Limited range: address space
+
+    bufferLen - Number of characters to be decoded.
+    - Data type: non-negative integer
+    - Default value: none
+    - Limited range: 0 ~ size_t
+
+    malformed - Pointer to a variable for number of malformed escape
+      sequences. It is ignored if not provided.
+    - Data type: size_t pointer
+    - Default value: NULL
+    - Limited range: address space
+
+    RETURN:
+    Number of decoded characters in the buffer.
+  */
+  static size_t urldecode(char *buffer,
+                          size_t bufferLen,
+                          size_t *malformed = NULL);
+
+  /**
+   * @brief Cummulate long uptime in seconds.
+   *
+   * @note Uptime in milliseconds beyond the overflow of millis() in 32-bit
+   * unsigned long is rounded up to seconds, i.e., every started second is
+   * counted.
+   * @note The maximum value for millis() is 4294967295 (2^32 - 1), which is
+   * about 49.71 days.
+   * @note Counting uptime in seconds enables uptime up to 136.1 years.
+   * @note Counting uptime seconds starts just at MCU boot and continues forever
+   * until MCU is running.
+   *
+   * @param uptimeMs Uptime in milliseconds.
+   *
+   * @return Cummulated uptime in seconds.
+   *
+   */
+  static inline unsigned long uptimeSecondsCummulate(unsigned long uptimeMs)
+  {
+    static unsigned long uptimeSec = 0;
+    static unsigned long secLast = 0;
+    unsigned long sec = 0;
+    // Calculate seconds from milliseconds with rounding
+    if (uptimeMs > static_cast<unsigned long>(UINT32_MAX) - 999)
+    {
+      // Safe fallback to avoid overflow
+      sec = uptimeMs / 1000 + 1;
+    }
+    else
+    {
+      sec = (uptimeMs + 999) / 1000;
+    }
+    // Uptime seconds cummulation
+    if (sec >= secLast)
+    {
+      secLast = sec;
+    }
+    // millis() overflow detected, cummulate seconds
+    else
+    {
+      uptimeSec += secLast;
+      secLast = sec;
+    }
+    return uptimeSec + secLast;
+  }
+
+  /*
+    Uptime counter with 64-bit milliseconds.
+
+    DESCRIPTION:
+    The class cummulates uptime of the microcontroller from milliseconds
+    provided by millis() or by another 32-bit milliseconds timer. Unlike the
+    method uptimeSecondsCummulate it keeps its state in the object, so that
+    there can be several independent counters.
+    - The overflow of the 32-bit timer is handled by modular subtraction of
+      the previous reading, so that the counter should be updated at least
+      once in 49.71 days.
+    - Both uptime in milliseconds and in whole seconds are cummulated at
+      updating. Seconds are incremented by comparison and subtraction of
+      a millisecond remainder, the division takes place only when more than
+      a second has elapsed since the previous update.
+    - There should be just one updating context, e.g., the main loop.
+      Reading is lock-free and can be done from any context including
+      interrupt service routines and the other core. The counter is kept in
+      two copies switched by a sequence number (a latch), so that a reader
+      interrupting the update reads the stable copy and never waits, and a
+      reader on the other core just repeats reading if an update took place
+      meanwhile.
+
+    USAGE:
+    gbj_apphelpers::UptimeCounter uptime;
+    uptime.update();
+    uint32_t seconds = uptime.getSeconds();
+  */
+  class UptimeCounter
+  {
+  public:
+    UptimeCounter(uint32_t startMs = 0) { reset(startMs); }
+
+    /*
+      Start counting uptime from zero.
+
+      PARAMETERS:
+      startMs - Reading of the milliseconds timer at the start of counting.
+        - Data type: non-negative integer
+        - Default value: 0
+        - Limited range: 0 ~ 2^32 - 1
+    */
+    void reset(uint32_t startMs = 0);
+
+    /*
+      Cummulate milliseconds elapsed since the previous update.
+
+      PARAMETERS:
+      ms - Current reading of the milliseconds timer.
+        - Data type: non-negative integer
+        - Default value: millis()
+        - Limited range: 0 ~ 2^32 - 1
+    */
+    void update(uint32_t ms);
+    inline void update() { update(millis()); }
+
+    /*
+      Uptime in milliseconds at the last update.
+    */
+    inline uint64_t getMs() const
+    {
+      Counts counts;
+      read(counts);
+      return counts.ms;
+    }
+
+    /*
+      Uptime in whole seconds at the last update.
+    */
+    inline uint32_t getSeconds() const
+    {
+      Counts counts;
+      read(counts);
+      return counts.seconds;
+    }
+
+  private:
+    struct Counts
+    {
+      uint64_t ms;
+      uint32_t seconds;
+    };
+    // Copy for readers is selected by the lowest bit of the sequence number
+    Counts latch_[2];
+    volatile uint8_t seq_;
+    // Updating state
+    Counts counts_;
+    uint32_t lastMs_;
+    uint16_t remainderMs_;
+
+    void publish();
+    inline void read(Counts &counts) const
+    {
+      uint8_t seq;
+      do
+      {
+        seq = seq_;
+        barrierAcquire();
+        counts.ms = latch_[seq & 1].ms;
+        counts.seconds = latch_[seq & 1].seconds;
+        barrierAcquire();
+      } while (seq != seq_);
+    }
+  };
+
+private:
+  // Pairs of decimal digits from "00" to "99"
+  static const char DIGIT_PAIRS[];
+  // Names of reboot sources registered by an application, NULL if none
+  static const __FlashStringHelper *getRebootTextUser(uint8_t index);
+
+  /*
+    Serialization of reboot records.
+
+    DESCRIPTION:
+    - A record consists of the sequence number, reason, 24-bit uptime,
+      epoch, count of the reason, and checksum in little endian byte order.
+    - Uptime below 2^23 seconds is in seconds, otherwise it is in minutes
+      flagged by the highest bit.
+    - A counter consists of 16-bit value and its check.
+    - Checksums of erased record and counter with all bits set are invalid.
+  */
+  static void packReboot(uint8_t *record,
+                         uint8_t seq,
+                         uint8_t reason,
+                         uint32_t uptime,
+                         uint32_t epoch,
+                         uint16_t count);
+  static void unpackReboot(const uint8_t *record, RebootRecord &rebootRecord);
+  static bool checkReboot(const uint8_t *record);
+  static inline uint16_t rebootCount(const uint8_t *record)
+  {
+    return record[9] | record[10] << 8;
+  }
+  static void packCounter(uint8_t *counter, uint16_t value);
+  static bool checkCounter(const uint8_t *counter);
+
+  /*
+    Memory barriers for data shared with interrupts and other cores.
+
+    DESCRIPTION:
+    - Acquire barrier orders preceding reads before succeeding ones.
+    - Release barrier orders preceding writes before succeeding ones.
+    - AVR microcontrollers are single core without reordering of memory
+      accesses, so that a compiler barrier is enough.
+  */
+  static inline void barrierAcquire()
+  {
+#if defined(__AVR__)
+    __asm__ __volatile__("" ::: "memory");
+#else
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+#endif
+  }
+  static inline void barrierRelease()
+  {
+#if defined(__AVR__)
+    __asm__ __volatile__("" ::: "memory");
+#else
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+#endif
+  }
+
+  /*
+    Compile time helpers of units conversion.
+
+    DESCRIPTION:
+    - The template SameType determines identity of types without the
+      standard library, which is not available on all platforms.
+    - The template UnitConversion combines constants of both units into
+      the numerator, shift, and denominator of the whole conversion reduced
+      by their greatest common divisor, i.e.,
+      target = (value * NUM + SHIFT) / DEN.
+    - The template UnitKernel applies the conversion to floating point or
+      integer values.
+  */
+  template<class A, class B>
+  struct SameType
+  {
+    static constexpr bool VALUE = false;
+  };
+  template<class A>
+  struct SameType<A, A>
+  {
+    static constexpr bool VALUE = true;
+  };
+  static constexpr int64_t gcd64(int64_t a, int64_t b)
+  {
+    return b ? gcd64(b, a % b) : (a < 0 ? -a : a);
+  }
+  template<class From, class To>
+  struct UnitConversion
+  {
+    static constexpr int64_t NUM_RAW = From::SCALE_NUM * To::SCALE_DEN *
+                                       From::OFFSET_DEN * To::OFFSET_DEN;
+    static constexpr int64_t SHIFT_RAW =
+      (From::OFFSET_NUM * To::OFFSET_DEN - To::OFFSET_NUM * From::OFFSET_DEN) *
+      To::SCALE_DEN * From::SCALE_DEN;
+    static constexpr int64_t DEN_RAW = From::SCALE_DEN * To::SCALE_NUM *
+                                       From::OFFSET_DEN * To::OFFSET_DEN;
+    static constexpr int64_t GCD = gcd64(gcd64(NUM_RAW, SHIFT_RAW), DEN_RAW);
+    static constexpr int64_t NUM = NUM_RAW / GCD;
+    static constexpr int64_t SHIFT = SHIFT_RAW / GCD;
+    static constexpr int64_t DEN = DEN_RAW / GCD;
+  };
+  template<bool Integral, class Dummy = void>
+  struct UnitKernel
+  {
+    template<class T, class C>
+    static constexpr T convert(T value)
+    {
+      return value * T(static_cast<double>(C::NUM) / C::DEN) +
+             T(static_cast<double>(C::SHIFT) / C::DEN);
+    }
+  };
+  template<class Dummy>
+  struct UnitKernel<true, Dummy>
+  {
+    // Pure scaling stays in the value data type without 64-bit arithmetic
+    template<class T, class C>
+    static constexpr T convert(T value)
+    {
+      return C::DEN == 1 ? T(value * T(C::NUM) + T(C::SHIFT))
+             : C::NUM == 1 && C::SHIFT == 0
+               ? ((value < 1 && value != 0)
+                    ? T(0) - (T(C::DEN / 2) - value) / T(C::DEN)
+                    : (value + T(C::DEN / 2)) / T(C::DEN))
+               : T(divideRound64(static_cast<int64_t>(value) * C::NUM +
+                                   C::SHIFT,
+                                 C::DEN));
+    }
+  };
+  static constexpr int64_t divideRound64(int64_t dividend, int64_t divisor)
+  {
+    return dividend >= 0 ? (dividend + divisor / 2) / divisor
+                         : -((divisor / 2 - dividend) / divisor);
+  }
+
+  // Integer division rounded half away from zero for positive divisor
+  static inline int32_t divideRound(int32_t dividend, int32_t divisor)
+  {
+    return dividend >= 0 ? (dividend + divisor / 2) / divisor
+                         : -((divisor / 2 - dividend) / divisor);
+  }
+
+  /*
+    Write empty string into a buffer if it has room for it.
+
+    RETURN:
+    Zero length of the string.
+  */
+  static inline size_t formatEmpty(char *buffer, size_t bufferSize)
+  {
+    if (bufferSize)
+    {
+      buffer[0] = '\0';
+    }
+    return 0;
+  }
+
+  /*
+    Write two decimal digits of a number below 100 into a buffer.
+  */
+  static inline void formatDigits(char *buffer, uint8_t number)
+  {
+    buffer[0] = pgm_read_byte(&DIGIT_PAIRS[2 * number]);
+    buffer[1] = pgm_read_byte(&DIGIT_PAIRS[2 * number + 1]);
+  }
+
+  /*
+    Write decimal digits of a number into a buffer without sprintf.
+
+    DESCRIPTION:
+    The method writes digits from the least significant pair of them by
+    the lookup table of digit pairs, so that it divides by 100 just once for
+    every two digits. The division is 16-bit as soon as the number fits.
+    - The fixed width variant pads the number with leading zeros or
+      truncates its most significant digits.
+    - The variable width variant writes as many digits as needed.
+    - No terminating null character is written.
+
+    RETURN:
+    Pointer to the buffer just after the last written digit.
+  */
+  static char *formatNumber(char *buffer, uint32_t number, uint8_t width);
+  static inline char *formatNumber(char *buffer, uint32_t number)
+  {
+    return formatNumber(buffer, number, digitsCount32(number));
+  }
+
+  /*
+    Write time "HH:MM:SS" or date "dd.mm.yyyy" into a buffer.
+
+    RETURN:
+    Pointer to the buffer just after the last written character without
+    terminating null character.
+  */
+  static inline char *formatTime(char *buffer,
+                                 uint8_t hours,
+                                 uint8_t minutes,
+                                 uint8_t seconds)
+  {
+    formatDigits(&buffer[0], hours);
+    buffer[2] = ':';
+    formatDigits(&buffer[3], minutes);
+    buffer[5] = ':';
+    formatDigits(&buffer[6], seconds);
+    return &buffer[8];
+  }
+  static inline char *formatDate(char *buffer, const Datetime &dtRecord)
+  {
+    formatDigits(&buffer[0], dtRecord.day);
+    buffer[2] = '.';
+    formatDigits(&buffer[3], dtRecord.month);
+    buffer[5] = '.';
+    return formatNumber(&buffer[6], dtRecord.year, 4);
+  }
+
+  /*
+    Format time period in seconds with provided delimiter of segments.
+    The null character as the delimiter means no delimiting of segments.
+
+    DESCRIPTION:
+    The method is a common implementation of formatting time periods with
+    or without spaces. Leading zero segments are omitted.
+
+    RETURN:
+    Length of formatted string or 0 if the buffer is too small.
+  */
+  static size_t formatPeriod(char *buffer,
+                             size_t bufferSize,
+                             uint32_t totalSeconds,
+                             char delimiter);
+
+  /*
+    Check and optionally sanitize data items for valid range.
+
+    DESCRIPTION:
+    The method is a common branchless kernel for range checking of buffers.
+    - If output buffer is not provided, data items are just checked.
+    - Invalid flag of each item is computed without branching and used for
+      selecting the output item, counting, and bitmask, so that compilers
+      can vectorize the loops.
+    - For float data on hosts with SSE2 or NEON instructions the overloaded
+      kernel processes 8 items at once explicitly.
+  */
+  template<class T>
+  static size_t rangeKernel(const T *dataIn,
+                            T *dataOut,
+                            size_t dataLen,
+                            T valDft,
+                            T valMin,
+                            T valMax,
+                            uint8_t *invalidMask)
+  {
+    size_t count = 0;
+    if (invalidMask)
+    {
+      for (size_t i = 0; i < dataLen; i += 8)
+      {
+        uint8_t bits = 0;
+        uint8_t block = dataLen - i < 8 ? dataLen - i : 8;
+        for (uint8_t j = 0; j < block; j++)
+        {
+          T val = dataIn[i + j];
+          bool invalid = (val < valMin) | (valMax < val);
+          bits |= invalid << j;
+          count += invalid;
+          if (dataOut)
+          {
+            dataOut[i + j] = invalid ? valDft : val;
+          }
+        }
+        invalidMask[i / 8] = bits;
+      }
+    }
+    else if (dataOut)
+    {
+      for (size_t i = 0; i < dataLen; i++)
+      {
+        T val = dataIn[i];
+        bool invalid = (val < valMin) | (valMax < val);
+        count += invalid;
+        dataOut[i] = invalid ? valDft : val;
+      }
+    }
+    else
+    {
+      for (size_t i = 0; i < dataLen; i++)
+      {
+        T val = dataIn[i];
+        count += (val < valMin) | (valMax < val);
+      }
+    }
+    return count;
+  }
+#if defined(__SSE2__) || defined(__ARM_NEON)
+  static size_t rangeKernel(const float *dataIn,
+                            float *dataOut,
+                            size_t dataLen,
+                            float valDft,
+                            float valMin,
+                            float valMax,
+                            uint8_t *invalidMask);
+#endif
+
+  enum SortParams : uint8_t
+  {
+    SORT_INSERTION_LIMIT = 16,
+    SORT_STABLE_BLOCK = 20,
+  };
+
+  enum UrlParams : uint16_t
+  {
+    // Characters written to a sink at once
+    URL_CHUNK_LEN = 64,
+    // Characters processed between yielding to the system
+    URL_YIELD_LEN = 512,
+    // Milliseconds processed between yielding to the system
+    URL_YIELD_MS = 10,
+  };
+
+  // Chunked writer of URL encoded or decoded characters into a sink
+  class UrlSink;
+
+  /*
+    Sort data items by insertion.
+
+    DESCRIPTION:
+    The method sorts short buffers stably and is a final stage of other
+    sorting algorithms.
+  */
+  template<class T, class Compare>
+  static inline void sortInsertion(T *dataBuffer, size_t dataLen, Compare comp)
+  {
+    for (size_t i = 1; i < dataLen; i++)
+    {
+      T item = dataBuffer[i];
+      size_t j = i;
+      while (j > 0 && comp(item, dataBuffer[j - 1]))
+      {
+        dataBuffer[j] = dataBuffer[j - 1];
+        j--;
+      }
+      dataBuffer[j] = item;
+    }
+  }
+
+  /*
+    Sort data items by heap sorting.
+
+    DESCRIPTION:
+    The method is a fallback of introspective sorting at degenerated
+    partitioning, which guarantees O(n*log(n)) time complexity.
+  */
+  template<class T, class Compare>
+  static void sortHeap(T *dataBuffer, size_t dataLen, Compare comp)
+  {
+    for (size_t i = dataLen / 2; i > 0; i--)
+    {
+      sortHeapSift(dataBuffer, i - 1, dataLen, comp);
+    }
+    for (size_t i = dataLen - 1; i > 0; i--)
+    {
+      swapdata(dataBuffer[0], dataBuffer[i]);
+      sortHeapSift(dataBuffer, 0, i, comp);
+    }
+  }
+  template<class T, class Compare>
+  static inline void sortHeapSift(T *dataBuffer,
+                                  size_t root,
+                                  size_t dataLen,
+                                  Compare comp)
+  {
+    size_t child;
+    while ((child = 2 * root + 1) < dataLen)
+    {
+      if (child + 1 < dataLen && comp(dataBuffer[child], dataBuffer[child + 1]))
+      {
+        child++;
+      }
+      if (!comp(dataBuffer[root], dataBuffer[child]))
+      {
+        return;
+      }
+      swapdata(dataBuffer[root], dataBuffer[child]);
+      root = child;
+    }
+  }
+
+  /*
+    Sort data items by introspective sorting.
+
+    DESCRIPTION:
+    The method partitions the buffer around median of three pivot, recurses
+    into the shorter partition and iterates over the longer one, so that the
+    recursion depth is at most log2(n).
+  */
+  template<class T, class Compare>
+  static void sortIntro(T *dataBuffer,
+                        size_t dataLen,
+                        uint8_t depthLimit,
+                        Compare comp)
+  {
+    while (dataLen > SORT_INSERTION_LIMIT)
+    {
+      if (depthLimit == 0)
+      {
+        sortHeap(dataBuffer, dataLen, comp);
+        return;
+      }
+      depthLimit--;
+      size_t cut = sortPartition(dataBuffer, dataLen, comp);
+      if (cut < dataLen - cut)
+      {
+        sortIntro(dataBuffer, cut, depthLimit, comp);
+        dataBuffer += cut;
+        dataLen -= cut;
+      }
+      else
+      {
+        sortIntro(dataBuffer + cut, dataLen - cut, depthLimit, comp);
+        dataLen = cut;
+      }
+    }
+    sortInsertion(dataBuffer, dataLen, comp);
+  }
+
+  /*
+    Partition data items around a pivot.
+
+    DESCRIPTION:
+    The method moves median of the second, middle, and last item to the
+    first position as a pivot and partitions the rest of the buffer.
+    - Items before the returned position do not follow the pivot and items
+      from that position do not precede it.
+    - Both partitions are not empty for buffers longer than 3 items.
+  */
+  template<class T, class Compare>
+  static inline size_t sortPartition(T *dataBuffer,
+                                     size_t dataLen,
+                                     Compare comp)
+  {
+    T *a = dataBuffer + 1;
+    T *b = dataBuffer + dataLen / 2;
+    T *c = dataBuffer + dataLen - 1;
+    T *median;
+    if (comp(*a, *b))
+    {
+      median = comp(*b, *c) ? b : (comp(*a, *c) ? c : a);
+    }
+    else
+    {
+      median = comp(*a, *c) ? a : (comp(*b, *c) ? c : b);
+    }
+    swapdata(*dataBuffer, *median);
+    T *lo = dataBuffer + 1;
+    T *hi = dataBuffer + dataLen;
+    while (true)
+    {
+      while (comp(*lo, *dataBuffer))
+      {
+        lo++;
+      }
+      hi--;
+      while (comp(*dataBuffer, *hi))
+      {
+        hi--;
+      }
+      if (!(lo < hi))
+      {
+        return lo - dataBuffer;
+      }
+      swapdata(*lo, *hi);
+      lo++;
+    }
   }
 
   /*
-    Format unix epoch time in seconds.
+    Merge two adjacent sorted ranges in place.
 
     DESCRIPTION:
-    The method formats input seconds as a unix epoch time to date and time
-    string all with leading zeros.
-
-    PARAMETERS:
-    epochSeconds - Seconds since 01.01.1970 00:00:00.
-      - Data type: 32-bit integer
-
-    RETURN:
-    String - formatted textual expression of a date and time.
+    The method merges sorted ranges [a, m) and [m, b) of the buffer stably
+    by symmetric merging algorithm (Kim and Kutzner) with rotations.
   */
-  static inline String formatEpochSeconds(unsigned long epochSeconds)
+  template<class T, class Compare>
+  static void sortMerge(T *dataBuffer, size_t a, size_t m, size_t b, Compare comp)
   {
-    // Number of days in month in normal year
-    int daysOfMonth[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
-    long day, month, year, hours, minutes, seconds;
-    long daysTillNow, extraTime, extraDays, index, flag = 0;
-    // Calculate total days
-    daysTillNow = epochSeconds / (24 * 60 * 60);
-    extraTime = epochSeconds % (24 * 60 * 60);
-    year = 1970;
-    // Calculating current year
-    while (true)
+    if (m - a == 1)
     {
-      if (year % 400 == 0 || (year % 4 == 0 && year % 100 != 0))
+      // Insert single leading item by binary search
+      size_t i = m;
+      size_t j = b;
+      while (i < j)
       {
-        if (daysTillNow < 366)
+        size_t h = (i + j) >> 1;
+        if (comp(dataBuffer[h], dataBuffer[a]))
         {
-          break;
+          i = h + 1;
         }
-        daysTillNow -= 366;
-      }
-      else
-      {
-        if (daysTillNow < 365)
+        else
         {
-          break;
+          j = h;
         }
-        daysTillNow -= 365;
       }
-      year += 1;
-    }
-    // Updating extradays because it will give days till previous day and we
-    // have include current day
-    extraDays = daysTillNow + 1;
-    if (year % 400 == 0 || (year % 4 == 0 && year % 100 != 0))
-    {
-      flag = 1;
+      for (size_t k = a; k + 1 < i; k++)
+      {
+        swapdata(dataBuffer[k], dataBuffer[k + 1]);
+      }
+      return;
     }
-    // Calculating MONTH and DAY
-    month = 0;
-    index = 0;
-    if (flag == 1)
+    if (b - m == 1)
     {
-      while (true)
+      // Insert single trailing item by binary search
+      size_t i = a;
+      size_t j = m;
+      while (i < j)
       {
-        if (index == 1)
+        size_t h = (i + j) >> 1;
+        if (!comp(dataBuffer[m], dataBuffer[h]))
         {
-          if (extraDays - 29 < 0)
-          {
-            break;
-          }
-          month += 1;
-          extraDays -= 29;
+          i = h + 1;
         }
         else
         {
-          if (extraDays - daysOfMonth[index] < 0)
-          {
-            break;
-          }
-          month += 1;
-          extraDays -= daysOfMonth[index];
+          j = h;
         }
-        index += 1;
       }
+      for (size_t k = m; k > i; k--)
+      {
+        swapdata(dataBuffer[k], dataBuffer[k - 1]);
+      }
+      return;
+    }
+    size_t mid = (a + b) >> 1;
+    size_t n = mid + m;
+    size_t start, r;
+    if (m > mid)
+    {
+      start = n - b;
+      r = mid;
     }
     else
     {
-      while (true)
+      start = a;
+      r = m;
+    }
+    size_t p = n - 1;
+    while (start < r)
+    {
+      size_t c = (start + r) >> 1;
+      if (!comp(dataBuffer[p - c], dataBuffer[c]))
       {
-        if (extraDays - daysOfMonth[index] < 0)
-        {
-          break;
-        }
-        month += 1;
-        extraDays -= daysOfMonth[index];
-        index += 1;
+        start = c + 1;
+      }
+      else
+      {
+        r = c;
       }
     }
-    // Current Month
-    if (extraDays > 0)
+    size_t end = n - start;
+    if (start < m && m < end)
     {
-      month += 1;
-      day = extraDays;
+      sortRotate(dataBuffer, start, m, end);
     }
-    else
+    if (a < start && start < mid)
+    {
+      sortMerge(dataBuffer, a, start, mid, comp);
+    }
+    if (mid < end && end < b)
+    {
+      sortMerge(dataBuffer, mid, end, b, comp);
+    }
+  }
+
+  /*
+    Rotate two adjacent ranges [a, m) and [m, b) by block swapping.
+  */
+  template<class T>
+  static inline void sortRotate(T *dataBuffer, size_t a, size_t m, size_t b)
+  {
+    size_t i = m - a;
+    size_t j = b - m;
+    while (i != j)
     {
-      if (month == 2 && flag == 1)
+      if (i > j)
       {
-        day = 29;
+        sortSwapRange(dataBuffer, m - i, m, j);
+        i -= j;
       }
       else
       {
-        day = daysOfMonth[month - 1];
+        sortSwapRange(dataBuffer, m - i, m + j - i, i);
+        j -= i;
       }
     }
-    hours = extraTime / 3600;
-    minutes = (extraTime % 3600) / 60;
-    seconds = (extraTime % 3600) % 60;
-    // Format output dd.mm.yyyy HH:MM:SS
-    char result[42];
-    sprintf(result,
-            "%02lu.%02lu.%04lu %02lu:%02lu:%02lu",
-            day,
-            month,
-            year,
-            hours,
-            minutes,
-            seconds);
-    return result;
+    sortSwapRange(dataBuffer, m - i, m, i);
+  }
+  template<class T>
+  static inline void sortSwapRange(T *dataBuffer, size_t a, size_t b, size_t n)
+  {
+    for (size_t i = 0; i < n; i++)
+    {
+      swapdata(dataBuffer[a + i], dataBuffer[b + i]);
+    }
   }
 
   /*
-    Format milliseconds to time period.
+    Convert double digit to number.
 
     DESCRIPTION:
-    The method formats input milliseconds to string with days, hours, minutes,
-    and seconds ([[x]xd ][[x]xh ][[x]xm ][x]xs).
-    - This is the wrapper method for methods 'formatTimePeriod' and
-    'convertMs2Sec'.
+    The method calculates number from pointed double character, which is
+    expected to be a double digit string.
 
     PARAMETERS:
-    ms - Milliseconds to be converted to seconds and formatted to time period.
-      - Data type: unsigned long integer
+    p - Pointer to characters.
+      - Data type: char pointer
       - Default value: none
-      - Limited range: 0 ~ (2^32 - 1)
+      - Limited range: address range
 
     RETURN:
-    String - formatted textual expresion of a time period provided in
-    milliseconds.
+    Number converted from double digit string.
   */
-  static inline String formatMsPeriod(uint32_t ms)
+  static inline uint8_t doubleDigit2Number(const char *p)
   {
-    return formatTimePeriod(convertMs2Sec(ms));
+    uint8_t num = 0;
+    if ('0' <= *p && *p <= '9')
+      num = *p - '0';
+    return 10 * num + *++p - '0';
   }
 
   /*
-    Provide URL encoding of the string.
+    Compile time counterparts of parsing helpers.
 
     DESCRIPTION:
-    The method escapes funny characters in a URL. For example a space is: %20.
-
-    PARAMETERS:
-    str - String to be encoded.
-    - Data type: String
-    - Default value: none
-    - Limited range: none
-
-    RETURN:
-    URL encoded string.
+    The methods follow the restrictions of constexpr functions in C++11,
+    i.e., they consist of a single return statement.
+  */
+  static constexpr uint8_t constDigit(char c)
+  {
+    return ('0' <= c && c <= '9') ? c - '0' : 0;
+  }
+  static constexpr uint8_t constNumber(const char *p)
+  {
+    return 10 * constDigit(p[0]) + constDigit(p[1]);
+  }
+  // Year of "Dec 26 2018"
+  static constexpr uint16_t constYear(const char *strDate)
+  {
+    return 100 * constNumber(&strDate[7]) + constNumber(&strDate[9]);
+  }
+  // Month of "Dec 26 2018": Jan Feb Mar Apr May Jun Jul Aug Sep Oct Nov Dec
+  static constexpr uint8_t constMonth(const char *strDate)
+  {
+    return strDate[0] == 'J'   ? (strDate[1] == 'a'   ? 1
+                                  : strDate[2] == 'n' ? 6
+                                                      : 7)
+           : strDate[0] == 'F' ? 2
+           : strDate[0] == 'A' ? (strDate[2] == 'r' ? 4 : 8)
+           : strDate[0] == 'M' ? (strDate[2] == 'r' ? 3 : 5)
+           : strDate[0] == 'S' ? 9
+           : strDate[0] == 'O' ? 10
+           : strDate[0] == 'N' ? 11
+                               : 12;
+  }
+  // Days since 01.01.1970 of "Dec 26 2018"
+  static constexpr uint32_t constDays(const char *strDate)
+  {
+    return daysFromCivil(
+      constYear(strDate), constMonth(strDate), constNumber(&strDate[4]));
+  }
 
-    CREDIT:
-    ESP8266 Hello World urlencode by Steve Nelson.
-    https://github.com/zenmanenergy/ESP8266-Arduino-Examples/tree/master/helloWorld_urlencoded
+  /*
+    Count digits in an unsigned integer by binary search of powers of ten.
   */
-  static String urlencode(String str);
+  static constexpr uint8_t digitsCount32(uint32_t n)
+  {
+    return n < 100000UL
+             ? (n < 100UL ? (n < 10UL ? 1 : 2)
+                          : (n < 1000UL ? 3 : (n < 10000UL ? 4 : 5)))
+             : (n < 10000000UL
+                  ? (n < 1000000UL ? 6 : 7)
+                  : (n < 100000000UL ? 8 : (n < 1000000000UL ? 9 : 10)));
+  }
+  static constexpr uint8_t digitsCount64(uint64_t n)
+  {
+    return n <= UINT32_MAX ? digitsCount32(static_cast<uint32_t>(n))
+           : n < 10000000000000ULL
+             ? (n < 100000000000ULL
+                  ? (n < 10000000000ULL ? 10 : 11)
+                  : (n < 1000000000000ULL ? 12 : 13))
+             : (n < 10000000000000000ULL
+                  ? (n < 100000000000000ULL
+                       ? 14
+                       : (n < 1000000000000000ULL ? 15 : 16))
+                  : (n < 100000000000000000ULL
+                       ? 17
+                       : (n < 1000000000000000000ULL
+                            ? 18
+                            : (n < 10000000000000000000ULL ? 19 : 20))));
+  }
 
   /*
-    Provide URL decoding of the string.
+    Calculate days since 01.01.1970 of a calendar date.
 
     DESCRIPTION:
-    The method converts all URL encoded characters to original funny characters
-    from a URL. For example a space is: %20.
-
-    PARAMETERS:
-    str - String to be decoded.
-    - Data type: String
-    - Default value: none
-    - Limited range: none
+    The method implements days from civil algorithm by H. Hinnant with years
+    starting on 1st March, so that the leap day is the last day of a year.
+    - Dates before 01.01.1970 are not supported.
 
     RETURN:
-    URL decoded string.
-
-    CREDIT:
-    ESP8266 Hello World urlencode by Steve Nelson.
-    https://github.com/zenmanenergy/ESP8266-Arduino-Examples/tree/master/helloWorld_urlencoded
+    Number of days since 01.01.1970.
   */
-  static String urldecode(String str);
-
-  /**
-   * @brief Cummulate long uptime in seconds.
-   *
-   * @note Uptime in milliseconds beyond the overflow of millis() in 32-bit
-   * unsigned long is rounded up to seconds, i.e., every started second is
-   * counted.
-   * @note The maximum value for millis() is 4294967295 (2^32 - 1), which is
-   * about 49.71 days.
-   * @note Counting uptime in seconds enables uptime up to 136.1 years.
-   * @note Counting uptime seconds starts just at MCU boot and continues forever
-   * until MCU is running.
-   *
-   * @param uptimeMs Uptime in milliseconds.
-   *
-   * @return Cummulated uptime in seconds.
-   *
-   */
-  static inline unsigned long uptimeSecondsCummulate(unsigned long uptimeMs)
+  static constexpr uint32_t daysFromCivil(uint16_t year,
+                                          uint8_t month,
+                                          uint8_t day)
   {
-    static unsigned long uptimeSec = 0;
-    static unsigned long secLast = 0;
-    unsigned long sec = 0;
-    // Calculate seconds from milliseconds with rounding
-    if (uptimeMs > static_cast<unsigned long>(UINT32_MAX) - 999)
-    {
-      // Safe fallback to avoid overflow
-      sec = uptimeMs / 1000 + 1;
-    }
-    else
-    {
-      sec = (uptimeMs + 999) / 1000;
-    }
-    // Uptime seconds cummulation
-    if (sec >= secLast)
-    {
-      secLast = sec;
-    }
-    // millis() overflow detected, cummulate seconds
-    else
-    {
-      uptimeSec += secLast;
-      secLast = sec;
-    }
-    return uptimeSec + secLast;
+    return daysFromEra((year - (month <= 2)) / 400,
+                       (year - (month <= 2)) % 400,
+                       (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 +
+                         day - 1);
+  }
+  static constexpr uint32_t daysFromEra(uint32_t era,
+                                        uint32_t yoe,
+                                        uint32_t doy)
+  {
+    return era * 146097UL + yoe * 365 + yoe / 4 - yoe / 100 + doy - 719468UL;
   }
 
-private:
   /*
-    Convert double digit to number.
+    Validate parsed datetime and store it as datetime record and epoch time.
 
     DESCRIPTION:
-    The method calculates number from pointed double character, which is
-    expected to be a double digit string.
+    The method is a common final step of parsing datetime strings.
 
     PARAMETERS:
-    p - Pointer to characters.
-      - Data type: char pointer
-      - Default value: none
-      - Limited range: address range
+    offset - Time offset from UTC in seconds of the parsed datetime.
 
     RETURN:
-    Number converted from double digit string.
+    Result code of parsing.
   */
-  static inline uint8_t doubleDigit2Number(const char *p)
-  {
-    uint8_t num = 0;
-    if ('0' <= *p && *p <= '9')
-      num = *p - '0';
-    return 10 * num + *++p - '0';
-  }
+  static ParseResults parseComplete(Datetime &dtRecord,
+                                    unsigned long *epochSeconds,
+                                    uint16_t year,
+                                    uint8_t month,
+                                    uint8_t day,
+                                    uint8_t hour,
+                                    uint8_t minute,
+                                    uint8_t second,
+                                    long offset);
 
   /*
     Parse compiler day format to datetime record.
@@ -817,68 +4304,6 @@ private:
     dtRecord.second = doubleDigit2Number(&strTime[6]);
   }
 
-  /*
-    Calculate altitude from barometric pressures.
-
-    DESCRIPTION:
-    The method calculates local altitude from provided local barometric pressure
-    and corresponding sea level pressure.
-    - Both input pressures should be in the same measurement unit. However that
-    unit can be arbitrary, usually Pascal or hectoPascal.
-
-    PARAMETERS:
-    pressure - Local barometric pressure in arbitrary measurement unit, usually
-    Pascal or hectoPascal.
-    - Data type: decimal
-    - Default value: none
-    - Limited range: none
-
-    pressureSea - Sea level barometric pressure in arbitrary measurement unit,
-    but the same as the first argument has.
-    - Data type: decimal
-    - Default value: none
-    - Limited range: none
-
-    RETURN:
-    Altitude in meters.
-  */
-  static inline float calculateAltitudeFromPressures(float pressure,
-                                                     float pressureSea)
-  {
-    return 44330.0 * (1.0 - pow(pressure / pressureSea, (1.0 / 5.255)));
-  }
-
-  /*
-    Calculate sea level barometric pressures.
-
-    DESCRIPTION:
-    The method calculates barometric pressure at sea level from provided local
-    pressure and altitude.
-    - The measurement unit of the local pressure can be arbitrary. However the
-    methods returns the sea level pressure in the same unit.
-
-    PARAMETERS:
-    pressure - Local barometric pressure in arbitrary measurement unit, usually
-    Pascal or hectoPascal.
-    - Data type: decimal
-    - Default value: none
-    - Limited range: none
-
-    altitude - Local altitude in meters for which the equivalent sea level
-    pressure should be calculated.
-    - Data type: decimal
-    - Default value: none
-    - Limited range: none
-
-    RETURN:
-    Barometric pressure at sea level.
-  */
-  static inline float calculatePressureSeaFromAltitude(float pressure,
-                                                       float altitude)
-  {
-    return pressure / pow(1.0 - altitude / 44330.0, 5.255);
-  }
-
   /*
     Convert character to number.
 
@@ -917,4 +4342,32 @@ private:
   }
 };
 
+/*
+  Registration of application reboot sources.
+
+  DESCRIPTION:
+  The macro defines textual names of reboot sources of an application with
+  codes from MCUREBOOT_USER in order of arguments. Names are stored in flash
+  memory and returned by the method getRebootText().
+  - The macro should be used just once in an application at global scope.
+  - A name longer than FORMAT_REBOOTTEXT_LEN is a compile error.
+
+  USAGE:
+  enum AppReboots : byte
+  {
+    REBOOT_MQTT = gbj_apphelpers::MCUREBOOT_USER,
+    REBOOT_OTA,
+  };
+  GBJ_APPHELPERS_REBOOTS("MQTT", "OTA update")
+*/
+#define GBJ_APPHELPERS_REBOOTS(...)                                            \
+  const __FlashStringHelper *gbj_apphelpers::getRebootTextUser(uint8_t index)  \
+  {                                                                            \
+    static const char texts[][gbj_apphelpers::FORMAT_REBOOTTEXT_LEN + 1]       \
+      PROGMEM = { __VA_ARGS__ };                                               \
+    return index < sizeof(texts) / sizeof(texts[0])                            \
+             ? reinterpret_cast<const __FlashStringHelper *>(texts[index])     \
+             : NULL;                                                           \
+  }
+
 #endif